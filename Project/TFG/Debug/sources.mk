@@ -24,9 +24,19 @@ OBJS :=
 # Every subdirectory with source files must be described here
 SUBDIRS := \
 src/TFTDisplay \
+src/TFTDisplay/bar_gauge \
 src/TFTDisplay/display_driver \
+src/TFTDisplay/display_transport \
+src/TFTDisplay/frame_arena \
+src/TFTDisplay/frame_buffer \
+src/TFTDisplay/headless_transport \
+src/TFTDisplay/history_chart \
 src/TFTDisplay/icon_manager \
+src/TFTDisplay/mono_expand \
+src/TFTDisplay/readout \
+src/TFTDisplay/render_queue \
 src/TFTDisplay/spi_master \
+src/TFTDisplay/text_rasterizer \
 src/app_data_storage \
 src/buttons \
 src/client_MQTT \
@@ -35,6 +45,8 @@ src \
 src/measures/BME688 \
 src/measures/IAQTracker \
 src/measures/LSM6DSOX \
+src/measures/MeasureHistory \
+src/measures/OrientationTracker \
 src/measures/i2c_master \
 src/measures \
 
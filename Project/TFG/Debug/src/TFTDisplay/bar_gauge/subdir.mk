@@ -0,0 +1,31 @@
+################################################################################
+# Automatically-generated file. Do not edit!
+################################################################################
+
+# Add inputs and outputs from these tool invocations to the build variables 
+CPP_SRCS += \
+../src/TFTDisplay/bar_gauge/bar_gauge.cpp 
+
+CPP_DEPS += \
+./src/TFTDisplay/bar_gauge/bar_gauge.d 
+
+OBJS += \
+./src/TFTDisplay/bar_gauge/bar_gauge.o 
+
+
+# Each subdirectory must supply rules for building sources it contributes
+src/TFTDisplay/bar_gauge/%.o: ../src/TFTDisplay/bar_gauge/%.cpp src/TFTDisplay/bar_gauge/subdir.mk
+	@echo 'Building file: $<'
+	@echo 'Invoking: Cross G++ Compiler'
+	arm-buildroot-linux-uclibcgnueabihf-g++ -I/home/ubuntu/Documents/buildroot-2022.11.1/output/host/usr/include -I/home/ubuntu/Documents/buildroot-2022.11.1/output/host/arm-buildroot-linux-uclibcgnueabihf/sysroot/usr/include -O0 -g3 -Wall -c -fmessage-length=0 -mfpu=neon-vfpv4 -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" -o "$@" "$<"
+	@echo 'Finished building: $<'
+	@echo ' '
+
+
+clean: clean-src-2f-TFTDisplay-2f-bar_gauge
+
+clean-src-2f-TFTDisplay-2f-bar_gauge:
+	-$(RM) ./src/TFTDisplay/bar_gauge/bar_gauge.d ./src/TFTDisplay/bar_gauge/bar_gauge.o
+
+.PHONY: clean-src-2f-TFTDisplay-2f-bar_gauge
+
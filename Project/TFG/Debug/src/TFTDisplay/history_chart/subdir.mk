@@ -0,0 +1,31 @@
+################################################################################
+# Automatically-generated file. Do not edit!
+################################################################################
+
+# Add inputs and outputs from these tool invocations to the build variables 
+CPP_SRCS += \
+../src/TFTDisplay/history_chart/history_chart.cpp 
+
+CPP_DEPS += \
+./src/TFTDisplay/history_chart/history_chart.d 
+
+OBJS += \
+./src/TFTDisplay/history_chart/history_chart.o 
+
+
+# Each subdirectory must supply rules for building sources it contributes
+src/TFTDisplay/history_chart/%.o: ../src/TFTDisplay/history_chart/%.cpp src/TFTDisplay/history_chart/subdir.mk
+	@echo 'Building file: $<'
+	@echo 'Invoking: Cross G++ Compiler'
+	arm-buildroot-linux-uclibcgnueabihf-g++ -I/home/ubuntu/Documents/buildroot-2022.11.1/output/host/usr/include -I/home/ubuntu/Documents/buildroot-2022.11.1/output/host/arm-buildroot-linux-uclibcgnueabihf/sysroot/usr/include -O0 -g3 -Wall -c -fmessage-length=0 -mfpu=neon-vfpv4 -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" -o "$@" "$<"
+	@echo 'Finished building: $<'
+	@echo ' '
+
+
+clean: clean-src-2f-TFTDisplay-2f-history_chart
+
+clean-src-2f-TFTDisplay-2f-history_chart:
+	-$(RM) ./src/TFTDisplay/history_chart/history_chart.d ./src/TFTDisplay/history_chart/history_chart.o
+
+.PHONY: clean-src-2f-TFTDisplay-2f-history_chart
+
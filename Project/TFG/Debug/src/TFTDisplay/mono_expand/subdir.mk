@@ -0,0 +1,31 @@
+################################################################################
+# Automatically-generated file. Do not edit!
+################################################################################
+
+# Add inputs and outputs from these tool invocations to the build variables 
+CPP_SRCS += \
+../src/TFTDisplay/mono_expand/mono_expand.cpp 
+
+CPP_DEPS += \
+./src/TFTDisplay/mono_expand/mono_expand.d 
+
+OBJS += \
+./src/TFTDisplay/mono_expand/mono_expand.o 
+
+
+# Each subdirectory must supply rules for building sources it contributes
+src/TFTDisplay/mono_expand/%.o: ../src/TFTDisplay/mono_expand/%.cpp src/TFTDisplay/mono_expand/subdir.mk
+	@echo 'Building file: $<'
+	@echo 'Invoking: Cross G++ Compiler'
+	arm-buildroot-linux-uclibcgnueabihf-g++ -I/home/ubuntu/Documents/buildroot-2022.11.1/output/host/usr/include -I/home/ubuntu/Documents/buildroot-2022.11.1/output/host/arm-buildroot-linux-uclibcgnueabihf/sysroot/usr/include -O0 -g3 -Wall -c -fmessage-length=0 -mfpu=neon-vfpv4 -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" -o "$@" "$<"
+	@echo 'Finished building: $<'
+	@echo ' '
+
+
+clean: clean-src-2f-TFTDisplay-2f-mono_expand
+
+clean-src-2f-TFTDisplay-2f-mono_expand:
+	-$(RM) ./src/TFTDisplay/mono_expand/mono_expand.d ./src/TFTDisplay/mono_expand/mono_expand.o
+
+.PHONY: clean-src-2f-TFTDisplay-2f-mono_expand
+
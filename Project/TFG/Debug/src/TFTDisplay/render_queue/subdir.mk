@@ -0,0 +1,31 @@
+################################################################################
+# Automatically-generated file. Do not edit!
+################################################################################
+
+# Add inputs and outputs from these tool invocations to the build variables 
+CPP_SRCS += \
+../src/TFTDisplay/render_queue/render_queue.cpp 
+
+CPP_DEPS += \
+./src/TFTDisplay/render_queue/render_queue.d 
+
+OBJS += \
+./src/TFTDisplay/render_queue/render_queue.o 
+
+
+# Each subdirectory must supply rules for building sources it contributes
+src/TFTDisplay/render_queue/%.o: ../src/TFTDisplay/render_queue/%.cpp src/TFTDisplay/render_queue/subdir.mk
+	@echo 'Building file: $<'
+	@echo 'Invoking: Cross G++ Compiler'
+	arm-buildroot-linux-uclibcgnueabihf-g++ -I/home/ubuntu/Documents/buildroot-2022.11.1/output/host/usr/include -I/home/ubuntu/Documents/buildroot-2022.11.1/output/host/arm-buildroot-linux-uclibcgnueabihf/sysroot/usr/include -O0 -g3 -Wall -c -fmessage-length=0 -mfpu=neon-vfpv4 -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" -o "$@" "$<"
+	@echo 'Finished building: $<'
+	@echo ' '
+
+
+clean: clean-src-2f-TFTDisplay-2f-render_queue
+
+clean-src-2f-TFTDisplay-2f-render_queue:
+	-$(RM) ./src/TFTDisplay/render_queue/render_queue.d ./src/TFTDisplay/render_queue/render_queue.o
+
+.PHONY: clean-src-2f-TFTDisplay-2f-render_queue
+
@@ -0,0 +1,31 @@
+################################################################################
+# Automatically-generated file. Do not edit!
+################################################################################
+
+# Add inputs and outputs from these tool invocations to the build variables 
+CPP_SRCS += \
+../src/measures/OrientationTracker/OrientationTracker.cpp 
+
+CPP_DEPS += \
+./src/measures/OrientationTracker/OrientationTracker.d 
+
+OBJS += \
+./src/measures/OrientationTracker/OrientationTracker.o 
+
+
+# Each subdirectory must supply rules for building sources it contributes
+src/measures/OrientationTracker/%.o: ../src/measures/OrientationTracker/%.cpp src/measures/OrientationTracker/subdir.mk
+	@echo 'Building file: $<'
+	@echo 'Invoking: Cross G++ Compiler'
+	arm-buildroot-linux-uclibcgnueabihf-g++ -I/home/ubuntu/Documents/buildroot-2022.11.1/output/host/usr/include -I/home/ubuntu/Documents/buildroot-2022.11.1/output/host/arm-buildroot-linux-uclibcgnueabihf/sysroot/usr/include -O0 -g3 -Wall -c -fmessage-length=0 -mfpu=neon-vfpv4 -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" -o "$@" "$<"
+	@echo 'Finished building: $<'
+	@echo ' '
+
+
+clean: clean-src-2f-measures-2f-OrientationTracker
+
+clean-src-2f-measures-2f-OrientationTracker:
+	-$(RM) ./src/measures/OrientationTracker/OrientationTracker.d ./src/measures/OrientationTracker/OrientationTracker.o
+
+.PHONY: clean-src-2f-measures-2f-OrientationTracker
+
@@ -0,0 +1,187 @@
+/**
+  ******************************************************************************
+  * @file   counting_transport.cpp
+  * @author Pablo San Millán Fierro (pablo.sanmillanf@alumnos.upm.es)
+  * @brief  Counting display transport Module.
+  *
+  * @note   End-of-degree work.
+  *         This module discards the command stream generated by
+  *         Display_driver and counts the bytes, ioctl calls and DC line
+  *         changes that SpidevTransport would need to send it.
+  ******************************************************************************
+*/
+
+/* Includes ------------------------------------------------------------------*/
+#include "counting_transport.h" // Module header
+#include <algorithm>
+
+/* Private defines -----------------------------------------------------------*/
+/* Private typedef -----------------------------------------------------------*/
+/* Private variables----------------------------------------------------------*/
+static const int max_transfers_per_msg = 64;  //Same limits used by SPI_Master
+static const int fill_buffer_size = 512;
+/* Private function prototypes -----------------------------------------------*/
+/* Functions -----------------------------------------------------------------*/
+
+/**
+ * @brief Class constructor.
+ *
+ * @param[in] max_transfer_size The spidev "bufsiz" to emulate.
+ */
+CountingTransport::CountingTransport(int max_transfer_size):
+    max_transfer_size(max_transfer_size), previous_cmd(false), counters(){
+}
+
+
+/**
+ * @brief Nothing to prepare.
+ *
+ * @return 0.
+ */
+int CountingTransport::start(){
+  return 0;
+}
+
+
+/**
+ * @brief Counts a block of bytes sent in one SPI message.
+ *
+ * @param[in] data The bytes.
+ * @param[in] size The number of bytes.
+ * @param[in] cmd If true, the data sent is a command, if false, it is normal data.
+ * @param[in] delay Ignored.
+ */
+void CountingTransport::send(const uint8_t data[], int size, uint8_t cmd, int delay){
+  set_dc_line(cmd);
+  counters.bytes += size;
+  counters.command_bytes += cmd ? size : 0;
+  counters.ioctls++;
+}
+
+
+/**
+ * @brief Counts a group of data blocks sent as one continuous stream.
+ *
+ * @param[in] segments The data blocks, in order.
+ * @param[in] count The number of blocks.
+ * @param[in] cmd If true, the data sent is a command, if false, it is normal data.
+ *
+ * @return 0.
+ */
+int CountingTransport::send_segments(const SPI_SEGMENT segments[], int count, uint8_t cmd){
+  int n_transfers = 0, msg_total = 0;
+
+  set_dc_line(cmd);
+
+  for(int i = 0; i < count; i++){
+    int remaining = segments[i].size;
+
+    counters.bytes += remaining;
+    counters.command_bytes += cmd ? remaining : 0;
+
+    while(remaining > 0){
+      if(msg_total == max_transfer_size || n_transfers == max_transfers_per_msg){
+        counters.ioctls++;
+        n_transfers = 0;
+        msg_total = 0;
+      }
+
+      int len = std::min(remaining, max_transfer_size - msg_total);
+      n_transfers++;
+      msg_total += len;
+      remaining -= len;
+    }
+  }
+
+  if(n_transfers != 0)
+    counters.ioctls++;
+
+  return 0;
+}
+
+
+/**
+ * @brief Counts the same pattern sent "repetitions" times as one continuous stream.
+ *
+ * @param[in] pattern The bytes to repeat.
+ * @param[in] pattern_size The number of bytes of the pattern.
+ * @param[in] repetitions The number of times the pattern is sent.
+ * @param[in] cmd If true, the data sent is a command, if false, it is normal data.
+ *
+ * @return 0 if success, -1 if error.
+ */
+int CountingTransport::send_fill(const uint8_t pattern[], int pattern_size, long repetitions, uint8_t cmd){
+  SPI_SEGMENT segments[max_transfers_per_msg];
+
+  if(pattern_size <= 0 || pattern_size > fill_buffer_size)
+    return -1;
+
+  int patterns_per_buffer = fill_buffer_size / pattern_size;
+  while(repetitions > 0){
+    int n_segments = 0;
+
+    while(repetitions > 0 && n_segments < max_transfers_per_msg){
+      long reps = std::min(repetitions, (long)patterns_per_buffer);
+      segments[n_segments].data = pattern;
+      segments[n_segments].size = reps * pattern_size;
+      n_segments++;
+      repetitions -= reps;
+    }
+
+    send_segments(segments, n_segments, cmd);
+  }
+
+  return 0;
+}
+
+
+/**
+ * @brief Obtain the emulated spidev "bufsiz".
+ *
+ * @return The maximum number of bytes per ioctl call.
+ */
+int CountingTransport::get_max_transfer_size(){
+  return max_transfer_size;
+}
+
+
+/**
+ * @brief Nothing to free.
+ *
+ * @return 0.
+ */
+int CountingTransport::end(){
+  return 0;
+}
+
+
+/**
+ * @brief Obtain the traffic counted since the last reset.
+ *
+ * @return The counters.
+ */
+TRANSPORT_COUNTERS CountingTransport::get_counters() const{
+  return counters;
+}
+
+
+/**
+ * @brief Sets all the counters to 0.
+ */
+void CountingTransport::reset_counters(){
+  counters = TRANSPORT_COUNTERS();
+}
+
+
+/* Private functions ---------------------------------------------------------*/
+/**
+ * @brief Counts a DC line write, done only when the type of the data changes, as SPI_Master does.
+ *
+ * @param[in] cmd If true, the following bytes are a command, if false, they are normal data.
+ */
+void CountingTransport::set_dc_line(uint8_t cmd){
+  if(previous_cmd != (bool)cmd){
+    previous_cmd = cmd;
+    counters.dc_changes++;
+  }
+}
@@ -0,0 +1,78 @@
+/**
+  ******************************************************************************
+  * @file   counting_transport.h
+  * @author Pablo San Millán Fierro (pablo.sanmillanf@alumnos.upm.es)
+  * @brief  Counting display transport Module Header.
+  *
+  * @note   End-of-degree work.
+  *         This module discards the command stream generated by
+  *         Display_driver and counts the bytes, ioctl calls and DC line
+  *         changes that SpidevTransport would need to send it.
+  ******************************************************************************
+*/
+
+#ifndef __COUNTING_TRANSPORT_H__
+#define __COUNTING_TRANSPORT_H__
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include "../src/TFTDisplay/display_transport/display_transport.h"
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+ * Traffic counted by a CountingTransport.
+ */
+typedef struct{
+  long bytes;           //Bytes sent, commands included
+  long command_bytes;   //Bytes sent with the DC line in command mode
+  long ioctls;          //ioctl calls that spidev would receive
+  long dc_changes;      //Writes of the DC GPIO
+}TRANSPORT_COUNTERS;
+
+/* Exported constants --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported Classes ----------------------------------------------------------*/
+
+/**
+ * Transport that only counts the traffic. The ioctl calls are counted packing the data the same way
+ * SPI_Master does with a spidev "bufsiz" of "max_transfer_size" bytes.
+ */
+class CountingTransport: public DisplayTransport{
+  int max_transfer_size;
+  bool previous_cmd;
+  TRANSPORT_COUNTERS counters;
+
+  void set_dc_line(uint8_t cmd);
+public:
+
+  /**
+   * @brief Class constructor.
+   *
+   * @param[in] max_transfer_size The spidev "bufsiz" to emulate.
+   */
+  CountingTransport(int max_transfer_size);
+
+  int start() override;
+  void send(const uint8_t data[], int size, uint8_t cmd, int delay) override;
+  int send_segments(const SPI_SEGMENT segments[], int count, uint8_t cmd) override;
+  int send_fill(const uint8_t pattern[], int pattern_size, long repetitions, uint8_t cmd) override;
+  int get_max_transfer_size() override;
+  int end() override;
+
+  /**
+   * @brief Obtain the traffic counted since the last reset.
+   *
+   * @return The counters.
+   */
+  TRANSPORT_COUNTERS get_counters() const;
+
+  /**
+   * @brief Sets all the counters to 0.
+   */
+  void reset_counters();
+};
+
+/* Exported Functions --------------------------------------------------------*/
+
+#endif /* __COUNTING_TRANSPORT_H__ */
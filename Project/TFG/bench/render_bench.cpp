@@ -0,0 +1,424 @@
+/**
+  ******************************************************************************
+  * @file   render_bench.cpp
+  * @author Pablo San Millán Fierro (pablo.sanmillanf@alumnos.upm.es)
+  * @brief  Render path microbenchmarks.
+  *
+  * @note   End-of-degree work.
+  *         Measures the cost of the display driver primitives and of every
+  *         TFTDisplay screen without a panel. The command stream is sent to
+  *         a CountingTransport, so the results include the SPI traffic that
+  *         the panel would receive.
+  *
+  *         Usage: render_bench [-n iterations] [-f filter]
+  *
+  *         Every case prints one JSON object per line with the averages per
+  *         iteration: wall time, bytes, command bytes, ioctl calls, DC line
+  *         changes, heap allocations and allocated bytes.
+  ******************************************************************************
+*/
+
+/* Includes ------------------------------------------------------------------*/
+#include "counting_transport.h"
+#include "../src/TFTDisplay/TFTDisplay.h"
+#include "../src/TFTDisplay/display_driver/display_driver.h"
+#include "../src/TFTDisplay/icon_manager/icon_manager.h"
+#include "../src/TFTDisplay/bar_gauge/bar_gauge.h"
+#include "../src/TFTDisplay/mono_expand/mono_expand.h"
+#include "../src/TFTDisplay/text_rasterizer/text_rasterizer.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <new>
+#include <string>
+#include <vector>
+
+/* Private defines -----------------------------------------------------------*/
+/* Private typedef -----------------------------------------------------------*/
+/* Private variables----------------------------------------------------------*/
+static const int default_iterations = 200;
+static const int spidev_bufsiz = 4096;
+
+static std::atomic<long> allocations(0);
+static std::atomic<long> allocated_bytes(0);
+
+static CountingTransport counting_transport(spidev_bufsiz);
+static Display_driver display(&counting_transport);
+static const char *filter = NULL;
+static int iterations = default_iterations;
+
+static uint8_t black[] = {0x00, 0x00};
+static uint8_t white[] = {0xFF, 0xFF};
+static uint8_t red[] = {0xF8, 0x00};
+/* Private function prototypes -----------------------------------------------*/
+static void run_case(const char *name, std::function<void (int)> setup, std::function<void (int)> body);
+static void driver_cases();
+static void screen_cases();
+static void screen_case(const char *name, std::function<void (int)> setup, std::function<void (int)> body);
+static void show_other_screen(int i);
+static std::vector<float> history(int i);
+static std::string number(float value);
+/* Functions -----------------------------------------------------------------*/
+
+/**
+ * Counted heap allocations. Every allocation of the process is counted, including the ones made by the
+ * render thread. The replacements are not inlined, so the compiler doesn't pair the inlined malloc and
+ * free with the new and delete expressions of the callers.
+ */
+__attribute__((noinline)) void *operator new(size_t size){
+  allocations++;
+  allocated_bytes += size;
+
+  void *ptr = malloc(size ? size : 1);
+  if(ptr == NULL)
+    throw std::bad_alloc();
+  return ptr;
+}
+
+__attribute__((noinline)) void operator delete(void *ptr) noexcept{
+  free(ptr);
+}
+
+__attribute__((noinline)) void operator delete(void *ptr, size_t size) noexcept{
+  free(ptr);
+}
+
+
+int main(int argc, char *argv[]){
+  int opt;
+
+  while((opt = getopt(argc, argv, "n:f:")) != -1){
+    switch(opt){
+      case 'n':
+        iterations = atoi(optarg);
+        break;
+      case 'f':
+        filter = optarg;
+        break;
+      default:
+        fprintf(stderr, "Usage: %s [-n iterations] [-f filter]\n", argv[0]);
+        return -1;
+    }
+  }
+
+  if(iterations <= 0){
+    fprintf(stderr, "ERROR: The number of iterations must be positive\n");
+    return -1;
+  }
+
+  TFTDisplay::set_display(&display);
+
+  driver_cases();
+  screen_cases();
+
+  return 0;
+}
+
+
+/* Private functions ---------------------------------------------------------*/
+/**
+ * @brief Runs a benchmark case and prints its results. Only "body" and sending what it flushed are measured.
+ *
+ * @param[in] name The case name. The case is skipped if it doesn't contain the filter.
+ * @param[in] setup Function called before every measured iteration, with the iteration number.
+ * @param[in] body The measured function, called with the iteration number.
+ */
+static void run_case(const char *name, std::function<void (int)> setup, std::function<void (int)> body){
+  if(filter != NULL && strstr(name, filter) == NULL)
+    return;
+
+  double total_ns = 0, min_ns = -1;
+  long total_allocations = 0, total_allocated_bytes = 0;
+  TRANSPORT_COUNTERS total = {0, 0, 0, 0};
+
+  for(int i = 0; i < iterations; i++){
+    if(setup)
+      setup(i);
+    display.wait_flush();
+
+    counting_transport.reset_counters();
+    long start_allocations = allocations, start_allocated_bytes = allocated_bytes;
+    auto start = std::chrono::steady_clock::now();
+
+    body(i);
+    display.wait_flush();
+
+    auto end = std::chrono::steady_clock::now();
+    double ns = std::chrono::duration<double, std::nano>(end - start).count();
+    TRANSPORT_COUNTERS counters = counting_transport.get_counters();
+    display.get_frame_arena().reset();  //Every iteration is a frame
+
+    total_ns += ns;
+    if(min_ns < 0 || ns < min_ns)
+      min_ns = ns;
+    total_allocations += allocations - start_allocations;
+    total_allocated_bytes += allocated_bytes - start_allocated_bytes;
+    total.bytes += counters.bytes;
+    total.command_bytes += counters.command_bytes;
+    total.ioctls += counters.ioctls;
+    total.dc_changes += counters.dc_changes;
+  }
+
+  printf("{\"case\": \"%s\", \"iterations\": %d, \"ns\": %.0f, \"min_ns\": %.0f, \"bytes\": %.1f, "
+      "\"command_bytes\": %.1f, \"ioctls\": %.1f, \"dc_changes\": %.1f, \"allocations\": %.1f, "
+      "\"allocated_bytes\": %.1f}\n",
+      name, iterations, total_ns / iterations, min_ns, (double)total.bytes / iterations,
+      (double)total.command_bytes / iterations, (double)total.ioctls / iterations,
+      (double)total.dc_changes / iterations, (double)total_allocations / iterations,
+      (double)total_allocated_bytes / iterations);
+  fflush(stdout);
+}
+
+
+/**
+ * @brief Display driver primitives and icon functions. They are called directly, so the render thread
+ *        must not be running.
+ */
+static void driver_cases(){
+  display.init_display();
+
+  static uint16_t text_row[240];
+
+  run_case("text_rasterizer/24pt", NULL, [](int i){
+    char str[] = "12:34:56";
+    str[7] = '0' + i % 10;
+    TextRasterizer text(str, FreeSansBold24pt7b, 0xFFFF, 0x0000);
+    for(int row = 0; row < text.get_height(); row++)
+      text.render_row(row, 0, text.get_width(), text_row);
+  });
+
+  run_case("text_rasterizer/12pt_long", NULL, [](int i){
+    char str[] = "Temperature offset 0";
+    str[19] = '0' + i % 10;
+    TextRasterizer text(str, FreeSansBold12pt7b, 0xFFFF, 0x0000);
+    for(int row = 0; row < text.get_height(); row++)
+      text.render_row(row, 0, std::min(text.get_width(), 240), text_row);
+  });
+
+  run_case("write_string/24pt+flush", NULL, [](int i){
+    char str[] = "12:34:56";
+    str[7] = '0' + i % 10;
+    display.write_string(20, 120, str, white, black, FreeSansBold24pt7b);
+    display.flush();
+  });
+
+  run_case("reset_region/full+flush", NULL, [](int i){
+    display.reset_region(0, 0, 240, 240, i % 2 ? white : black);
+    display.flush();
+  });
+
+  run_case("reset_region/64x64+flush", NULL, [](int i){
+    display.reset_region(88, 88, 152, 152, i % 2 ? white : red);
+    display.flush();
+  });
+
+  static std::vector<uint16_t> bitmaps[2];
+  for(int b = 0; b < 2; b++){
+    bitmaps[b].resize(100 * 100);
+    for(size_t p = 0; p < bitmaps[b].size(); p++)
+      bitmaps[b][p] = (p * (b + 7)) & 0xFFFF;
+  }
+  run_case("draw_icon/100x100+flush", NULL, [](int i){
+    display.draw_icon(70, 70, 100, bitmaps[i % 2].data(), bitmaps[i % 2].size());
+    display.flush();
+  });
+
+  run_case("draw_icon_col/clock+flush", NULL, [](int i){
+    display.draw_icon_col(70, 40, Icons::clock_icon_width, Icons::clock_icon.data(),
+        Icons::clock_icon.size(), black, i % 2 ? white : red);
+    display.flush();
+  });
+
+  static std::vector<uint8_t> mono_screen(240 * 240 / 8);
+  static std::vector<uint16_t> expanded_screen(240 * 240);
+  for(size_t b = 0; b < mono_screen.size(); b++)
+    mono_screen[b] = b * 37;
+  std::string expand_name = std::string("mono_expand/") + MonoExpand::get_kernel_name() + "/240x240";
+  run_case(expand_name.c_str(), NULL, [](int i){
+    MonoExpand::expand(mono_screen.data(), i % 8, 240 * 240 - 8, 0xFFFF, 0x00F8, expanded_screen.data());
+  });
+
+  run_case("get_temperature_icon", NULL, [](int i){
+    Icons::get_temperature_icon(i % 101, display.get_frame_arena());
+  });
+
+  run_case("get_humidity_icon", NULL, [](int i){
+    Icons::get_humidity_icon(i % 101, display.get_frame_arena());
+  });
+
+  run_case("get_iaq_icon", NULL, [](int i){
+    Icons::get_iaq_icon(i % 501, display.get_frame_arena());
+  });
+
+  run_case("get_main_menu_indicator_icon", NULL, [](int i){
+    Icons::get_main_menu_indicator_icon(i % 6 + 1, display.get_frame_arena());
+  });
+
+  static BarGauge gauge(Icons::temperature_bar, 25, 60);
+  gauge.draw(display, 0, black, red);
+  display.flush();
+  run_case("bar_gauge/temperature+flush", NULL, [](int i){
+    gauge.draw(display, (i * 7) % 101, black, red);
+    display.flush();
+  });
+
+  display.uninit();
+}
+
+
+/**
+ * @brief TFTDisplay screens. Every measure includes queuing the screen and waiting for the render thread
+ *        to draw it.
+ */
+static void screen_cases(){
+  std::vector<std::string> menus = {"Carrusel", "IP Broker", "Token MQTT", "Temp Offset"};
+  std::vector<std::string> text_list = {"MOVISTAR_1234", "vodafone5678", "Red de invitados muy larga"};
+
+  TFTDisplay::start();
+
+  screen_case("print_main_menu_time/full", show_other_screen, [](int i){
+    TFTDisplay::print_main_menu_time(true, "12:34:5" + std::to_string(i % 10));
+  });
+  screen_case("print_main_menu_time/update", NULL, [](int i){
+    TFTDisplay::print_main_menu_time(false, "12:34:5" + std::to_string(i % 10));
+  });
+
+  screen_case("print_main_menu_temp/full", show_other_screen, [](int i){
+    TFTDisplay::print_main_menu_temp(true, 20 + i * 0.01, 50);
+  });
+  screen_case("print_main_menu_temp/update", NULL, [](int i){
+    TFTDisplay::print_main_menu_temp(false, 20 + i * 0.01, 50 + i % 20);
+  });
+
+  screen_case("print_main_menu_hum/full", show_other_screen, [](int i){
+    TFTDisplay::print_main_menu_hum(true, 40 + i * 0.01);
+  });
+  screen_case("print_main_menu_hum/update", NULL, [](int i){
+    TFTDisplay::print_main_menu_hum(false, 40 + (i % 20) + i * 0.01);
+  });
+
+  screen_case("print_main_menu_press/full", show_other_screen, [](int i){
+    TFTDisplay::print_main_menu_press(true, 101325 + i * 0.01);
+  });
+  screen_case("print_main_menu_press/update", NULL, [](int i){
+    TFTDisplay::print_main_menu_press(false, 101325 + i * 0.01);
+  });
+
+  screen_case("print_main_menu_alt/full", show_other_screen, [](int i){
+    TFTDisplay::print_main_menu_alt(true, 650 + i * 0.01);
+  });
+  screen_case("print_main_menu_alt/update", NULL, [](int i){
+    TFTDisplay::print_main_menu_alt(false, 650 + i * 0.01);
+  });
+
+  screen_case("print_main_menu_iaq/full", show_other_screen, [](int i){
+    TFTDisplay::print_main_menu_iaq(true, 60 + i * 0.01);
+  });
+  screen_case("print_main_menu_iaq/update", NULL, [](int i){
+    TFTDisplay::print_main_menu_iaq(false, 60 + (i % 40) + i * 0.01);
+  });
+
+  screen_case("print_history_chart/full", show_other_screen, [](int i){
+    TFTDisplay::print_history_chart(true, "Temperatura", "60 min", history(i), 200 + i, 1, 1);
+  });
+  screen_case("print_history_chart/scroll", NULL, [](int i){
+    TFTDisplay::print_history_chart(false, "Temperatura", "60 min", history(i), 200 + i, 1, 1);
+  });
+
+  screen_case("print_conf_menu/full", show_other_screen, [&menus](int i){
+    TFTDisplay::print_conf_menu(true, menus, i % 4);
+  });
+  screen_case("print_conf_menu/selection", NULL, [&menus](int i){
+    TFTDisplay::print_conf_menu(false, menus, (i + 1) % 4);
+  });
+  screen_case("print_conf_menu/menus", NULL, [&menus](int i){
+    TFTDisplay::print_conf_menu(false, menus, i % 4);
+  });
+
+  screen_case("print_centered_title/medium", show_other_screen, [](int i){
+    TFTDisplay::print_centered_title("Iniciando" + std::string(i % 4, '.'), 2);
+  });
+  screen_case("print_centered_title/multiline", show_other_screen, [](int i){
+    TFTDisplay::print_centered_title("La clave debe\ntener entre\n8 y 63\ncaracteres.", 1);
+  });
+
+  screen_case("print_selection_text", show_other_screen, [](int i){
+    TFTDisplay::print_selection_text("Guardar?", 2);
+  });
+
+  screen_case("print_editable_text/full", [](int i){
+    TFTDisplay::print_centered_title("IP", 2);
+  }, [](int i){
+    TFTDisplay::print_editable_text(true, "192.1", 0);
+  });
+  screen_case("print_editable_text/selection", NULL, [](int i){
+    TFTDisplay::print_editable_text(false, "192.1", (i + 1) % 5);
+  });
+  screen_case("print_editable_text/letters", NULL, [](int i){
+    TFTDisplay::print_editable_text(false, number(i % 100), 1);
+  });
+
+  screen_case("print_text_list/full", show_other_screen, [&text_list](int i){
+    TFTDisplay::print_text_list(true, true, text_list, [](){ return true; });
+  });
+  screen_case("print_text_list/refresh", NULL, [&text_list](int i){
+    std::vector<std::string> rotated(text_list.begin() + i % 3, text_list.end());
+    rotated.insert(rotated.end(), text_list.begin(), text_list.begin() + i % 3);
+    TFTDisplay::print_text_list(false, true, rotated, [](){ return true; });
+  });
+
+  TFTDisplay::end();
+}
+
+
+/**
+ * @brief Runs a benchmark case of a TFTDisplay screen. The render thread is idle before "body" starts
+ *        and the measure ends when it has drawn the screen.
+ */
+static void screen_case(const char *name, std::function<void (int)> setup, std::function<void (int)> body){
+  run_case(name, [setup](int i){
+    if(setup)
+      setup(i);
+    TFTDisplay::wait_idle();
+  }, [body](int i){
+    body(i);
+    TFTDisplay::wait_idle();
+  });
+}
+
+
+/**
+ * @brief Shows a screen different from the measured ones, so every full refresh starts from another
+ *        screen, as when the user moves between menus.
+ */
+static void show_other_screen(int i){
+  TFTDisplay::print_centered_title(i % 2 ? "Conectando" : "Espere", 2);
+}
+
+
+/**
+ * @brief Obtains the 200 samples of a slowly changing measure that a history would have after 200 + "i"
+ *        samples.
+ */
+static std::vector<float> history(int i){
+  std::vector<float> samples(200);
+  for(int s = 0; s < 200; s++)
+    samples[s] = 22 + 0.3f * std::sin((i + s) / 15.0f);
+  return samples;
+}
+
+
+/**
+ * @brief Converts a number into a string of five characters padded with dots.
+ */
+static std::string number(float value){
+  std::string result = std::to_string((int)value);
+  result.resize(5, '.');
+  return result;
+}
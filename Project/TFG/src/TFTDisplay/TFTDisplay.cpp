@@ -13,8 +13,16 @@
 #include "TFTDisplay.h"
 #include "display_driver/display_driver.h"
 #include "icon_manager/icon_manager.h"
-#include <iomanip>
+#include "render_queue/render_queue.h"
+#include "readout/readout.h"
+#include "bar_gauge/bar_gauge.h"
+#include "history_chart/history_chart.h"
+#include <stdio.h>
+#include <string.h>
+#include <atomic>
+#include <memory>
 #include <sstream>
+#include <thread>
 
 
 /* External variables---------------------------------------------------------*/
@@ -39,31 +47,209 @@ uint8_t TFTDisplay::range_201_250_iaq_color[] = {0xF8, 0x00};
 uint8_t TFTDisplay::range_251_350_iaq_color[] = {0x98, 0x13};
 uint8_t TFTDisplay::range_351_plus_iaq_color[] = {0x30, 0xA0};
 
+uint8_t TFTDisplay::chart_color[] = {0x07, 0xFF};
+
 const int TFTDisplay::max_conf_menus = 4;
 const int TFTDisplay::max_chars_edit_menu = 5;
 const int TFTDisplay::max_text_list_elements = 3;
 const int TFTDisplay::central_text_list_element = 1;
 /* Private defines -----------------------------------------------------------*/
 /* Private typedef -----------------------------------------------------------*/
+enum{                 //Keys of the draw commands that can replace the previous ones
+  NO_KEY = 0,
+  TIME_KEY,
+  TEMP_KEY,
+  HUM_KEY,
+  PRESS_KEY,
+  ALT_KEY,
+  IAQ_KEY,
+  TEXT_LIST_KEY,
+  ROTATION_KEY,
+  CHART_KEY,
+  CONF_MENU_KEY,
+  EDIT_TEXT_KEY
+};
+
+enum{                 //Screens whose static elements are composed once and reused as a template
+  TIME_TEMPLATE = 0,
+  TEMP_TEMPLATE,
+  HUM_TEMPLATE,
+  PRESS_TEMPLATE,
+  ALT_TEMPLATE,
+  IAQ_TEMPLATE,
+  CONF_MENU_TEMPLATE,
+  TEMPLATE_COUNT
+};
+
+typedef struct{
+  std::vector<uint8_t> bits;      //1 bit per pixel. Empty until the template is composed for the first time
+  uint16_t main_color;            //Colors used to compose the template
+  uint16_t background_color;
+}SCREEN_TEMPLATE;
 /* Private variables----------------------------------------------------------*/
 static const int conf_menu_y_offset = 68;
+//Panel used if set_display isn't called. It is only created by start, so the frame buffers of an unused
+//panel are never allocated
+static std::unique_ptr<SpidevTransport> default_transport;
+static std::unique_ptr<Display_driver> default_display;
+static Display_driver *display = NULL;                              //Panel where the screens are drawn
+static RenderQueue render_queue;
+static std::thread render_thread;
+static std::atomic<DISPLAY_ROTATION> requested_rotation(ROTATION_0);   //Applied by the render thread
+static bool display_asleep = false;                                  //Only used by the render thread
+
+//Main menu measures. They only redraw the characters that change between two updates
+static Readout time_readout(0, 185, 200, true, FreeSansBold24pt7b);
+static Readout temp_readout(100, 90, 140, false, FreeSansBold24pt7b);
+static Readout hum_readout(110, 100, 130, false, FreeSansBold24pt7b);
+static Readout press_readout(0, 165, 220, true, FreeSansBold18pt7b);
+static Readout alt_readout(0, 180, 200, true, FreeSansBold18pt7b);
+static Readout iaq_readout(0, 180, 200, true, FreeSansBold18pt7b);
+
+//Main menu bars. They only redraw the rows between the previous and the new level
+static BarGauge temp_gauge(Icons::temperature_bar, 25, 60);
+static BarGauge hum_gauge(Icons::humidity_bar, 20, 60);
+static BarGauge iaq_gauge(Icons::iaq_bar, 120 - Icons::iaq_icon_width/2, 45);
+
+//History chart. It only draws the columns of the new samples
+static HistoryChart history_chart(20, 66, 200, 120);
+static Readout chart_max_readout(20, 58, 100, false, FreeSansBold12pt7b);
+static Readout chart_min_readout(20, 210, 100, false, FreeSansBold12pt7b);
+
+static SCREEN_TEMPLATE screen_templates[TEMPLATE_COUNT];
+
+//Menus as they are in the Display, so the partial updates only redraw what differs. Empty or -1 if unknown
+static std::vector<std::string> drawn_conf_menus;
+static int drawn_conf_selected = -1;
+static std::string drawn_editable_text;
+static int drawn_editable_selected = -1;
+static std::vector<std::string> drawn_text_list;
 /* Private function prototypes -----------------------------------------------*/
+static void render_thread_fn();
+namespace TFTDisplay{
+static void draw_screen_template(int template_id, std::function<void ()> compose);
+static void compose_main_menu(int indicator_position);
+static std::string format_decimal(float value, int precision, const char suffix[]);
+static void draw_main_menu_time(bool full_refresh, std::string time);
+static void draw_main_menu_temp(bool full_refresh, float temp, uint8_t percentage);
+static void draw_main_menu_hum(bool full_refresh, float hum);
+static void draw_main_menu_press(bool full_refresh, float press);
+static void draw_main_menu_alt(bool full_refresh, float alt);
+static void draw_main_menu_iaq(bool full_refresh, float iaq);
+static void draw_history_chart(bool full_refresh, std::string title, std::string span_label,
+                               const std::vector<float> &samples, long sequence, float min_span, int precision);
+static void draw_conf_menu(bool full_refresh, const std::vector<std::string> &menus, int selected);
+static void draw_conf_menu_row(const std::vector<std::string> &menus, int row, bool selected);
+static void draw_centered_title(std::string title, uint8_t size);
+static void draw_selection_text(std::string title, int size);
+static void draw_editable_text(bool full_refresh, const std::string &editable_text, int selected_char);
+static void draw_editable_char(const std::string &editable_text, int position, bool selected, bool was_selected);
+static void draw_text_list(bool full_refresh, bool list_refresh,
+                           const std::vector<std::string> &text_list, std::function<bool ()> exit);
+}
 /* Functions -----------------------------------------------------------------*/
 
 /**
- * @brief Initializes the display with a black background.
+ * @brief Selects the panel where the screens are drawn. By default they are drawn in the panel connected to
+ *        spidev0.0 with the DC line in GPIO17, which is only created by start if this function hasn't been
+ *        called. Must be called before start and the display must remain valid until end returns.
+ *
+ * @param[in] new_display The display.
+ */
+void TFTDisplay::set_display(Display_driver *new_display){
+  display = new_display;
+}
+
+
+/**
+ * @brief Rotates the contents of the Display. The rotation is done by the panel, so the current screen is
+ *        only sent again, in the new orientation, without being redrawn. Can be called before start.
+ *
+ * @param[in] rotation The rotation.
+ */
+void TFTDisplay::set_rotation(DISPLAY_ROTATION rotation){
+  requested_rotation = rotation;
+
+  //The render thread applies the rotation before any command, so it isn't lost if a newer screen
+  //replaces this command
+  render_queue.push({ROTATION_KEY, false, [](){
+    display->flush();
+  }, false});
+}
+
+
+/**
+ * @brief Initializes the display with a black background and starts the render thread. From now on,
+ *        the print functions only queue the requested screen and return. The render thread draws the
+ *        queued screens in order, skipping the ones that a newer request makes obsolete.
  */
 void TFTDisplay::start(){
-  Display_driver::init_display();
+  if(display == NULL){
+    default_transport.reset(new SpidevTransport(0, 17, 0, 8, 62500000));   //spidev0.0 with the DC line in GPIO17
+    default_display.reset(new Display_driver(default_transport.get()));
+    display = default_display.get();
+  }
+  display->set_rotation(requested_rotation);
+  display->init_display();
+  render_thread = std::thread(render_thread_fn);
 }
 
+
 /**
- * @brief Ends SPI communications and release all the related resources.
+ * @brief Draws the pending screens, stops the render thread and releases all the display resources.
  */
 void TFTDisplay::end(){
-  Display_driver::uninit();
+  render_queue.close();
+  render_thread.join();
+
+  if(display == default_display.get()){
+    default_display.reset();
+    default_transport.reset();
+    display = NULL;
+  }
 }
 
+
+/**
+ * @brief Waits until all the requested screens have been drawn and sent to the Display.
+ */
+void TFTDisplay::wait_idle(){
+  render_queue.wait_idle();
+  display->wait_flush();
+}
+
+
+/**
+ * @brief Turns the Display off once the pending screens have been drawn. The panel keeps the last screen in
+ *        its memory while it is off and the rotations requested meanwhile are only applied when it is
+ *        turned on, so nothing is sent to the panel while nothing new is requested.
+ */
+void TFTDisplay::sleep(){
+  render_queue.push({NO_KEY, false, [](){
+    display->flush();
+    display->sleep_display();
+    display_asleep = true;
+  }, false});
+}
+
+
+/**
+ * @brief Turns the Display on again. The panel shows the screen it kept while it was off, so it doesn't
+ *        have to be sent again; only a rotation requested meanwhile makes it be sent in the new orientation.
+ */
+void TFTDisplay::wake(){
+  render_queue.push({NO_KEY, false, [](){
+    //The panel can receive pixels while sleeping, so the rotation is sent before it is seen
+    if(display->get_rotation() != requested_rotation){
+      display->set_rotation(requested_rotation);
+      display->flush();
+    }
+    display->wake_display();
+    display_asleep = false;
+  }, false});
+}
+
+
 /**
  * @brief Prints in the Display all the elements associated to the time main menu
  *
@@ -72,22 +258,9 @@ void TFTDisplay::end(){
  * @param[in] time The time as a string.
  */
 void TFTDisplay::print_main_menu_time(bool full_refresh, std::string time){
-
-  if(full_refresh){
-    Display_driver::reset_region(0, 0, 240, 240, background_color);
-    std::vector<uint16_t> icon = Icons::get_main_menu_indicator_icon(1);
-    Display_driver::draw_icon_col(
-        72, 16, Icons::main_menu_indicator_width, icon.data(), icon.size(), background_color, main_color);
-    Display_driver::draw_icon_col(
-        60, 198, Icons::main_conf_icon_width, Icons::main_conf_icon.data(), Icons::main_conf_icon.size(),
-        background_color, main_color);
-    Display_driver::draw_icon_col(
-        70, 40, Icons::clock_icon_width, Icons::clock_icon.data(), Icons::clock_icon.size(),
-        background_color, main_color);
-  }
-
-  Display_driver::write_string_centered_with_min_width(
-      185, 200,(char*) time.c_str(), main_color, background_color, FreeSansBold24pt7b);
+  render_queue.push({full_refresh ? NO_KEY : TIME_KEY, full_refresh, [=](){
+    draw_main_menu_time(full_refresh, time);
+  }});
 }
 
 
@@ -100,23 +273,336 @@ void TFTDisplay::print_main_menu_time(bool full_refresh, std::string time){
  * @param[in] percentage The bar percentage. Percentages greater than 100 will be truncated to 100.
  */
 void TFTDisplay::print_main_menu_temp(bool full_refresh, float temp, uint8_t percentage){
+  render_queue.push({full_refresh ? NO_KEY : TEMP_KEY, full_refresh, [=](){
+    draw_main_menu_temp(full_refresh, temp, percentage);
+  }});
+}
+
+
+/**
+ * @brief Prints in the Display all the elements associated to the humidity main menu
+ *
+ * @param[in] full_refresh True if all the window have to be reloaded, False if only the humidity,
+ *                         bar and color has to be reloaded.
+ * @param[in] hum The humidity percentage as a float. This value will be rounded to 2 decimals.
+ *                Percentages greater than 100 will be truncated to 100.
+ */
+void TFTDisplay::print_main_menu_hum(bool full_refresh, float hum){
+  render_queue.push({full_refresh ? NO_KEY : HUM_KEY, full_refresh, [=](){
+    draw_main_menu_hum(full_refresh, hum);
+  }});
+}
+
+
+/**
+ * @brief Prints in the Display all the elements associated to the pressure main menu
+ *
+ * @param[in] full_refresh True if all the window have to be reloaded, False if only the pressure
+ *                         has to be reloaded.
+ * @param[in] press The pressure as a float. This value will be rounded to 2 decimals.
+ */
+void TFTDisplay::print_main_menu_press(bool full_refresh, float press){
+  render_queue.push({full_refresh ? NO_KEY : PRESS_KEY, full_refresh, [=](){
+    draw_main_menu_press(full_refresh, press);
+  }});
+}
+
+
+/**
+ * @brief Prints in the Display all the elements associated to the altitude main menu
+ *
+ * @param[in] full_refresh True if all the window have to be reloaded, False if only the
+ *                         altitude has to be reloaded.
+ * @param[in] alt The altitude as a float. This value will be rounded to 2 decimals.
+ */
+void TFTDisplay::print_main_menu_alt(bool full_refresh, float alt){
+  render_queue.push({full_refresh ? NO_KEY : ALT_KEY, full_refresh, [=](){
+    draw_main_menu_alt(full_refresh, alt);
+  }});
+}
+
+
+/**
+ * @brief Prints in the Display all the elements associated to the IAQ main menu
+ *
+ * @param[in] full_refresh True if all the window have to be reloaded, False if only the IAQ,
+ *                         bar and color has to be reloaded.
+ * @param[in] iaq The IAQ as a float. This value will be rounded to 2 decimals.
+ */
+void TFTDisplay::print_main_menu_iaq(bool full_refresh, float iaq){
+  render_queue.push({full_refresh ? NO_KEY : IAQ_KEY, full_refresh, [=](){
+    draw_main_menu_iaq(full_refresh, iaq);
+  }});
+}
+
+
+/**
+ * @brief Prints in the Display the history chart of a measure, with the values of its top and bottom rows.
+ *        While the same chart is shown, only the columns of the new samples are drawn.
+ *
+ * @param[in] full_refresh True if all the window have to be reloaded, False if only the new samples and the
+ *                         scale have to be reloaded.
+ * @param[in] title The title of the chart.
+ * @param[in] span_label The time shown by the chart, written below it.
+ * @param[in] samples The samples of the history, from the oldest to the newest.
+ * @param[in] sequence The number of samples added to the history since its start, as returned by
+ *                     MeasureHistory::get_samples.
+ * @param[in] min_span The minimum difference between the values of the top and bottom rows.
+ * @param[in] precision The number of decimals of the values of the top and bottom rows.
+ */
+void TFTDisplay::print_history_chart(bool full_refresh, std::string title, std::string span_label,
+                                     std::vector<float> samples, long sequence, float min_span, int precision){
+  render_queue.push({full_refresh ? NO_KEY : CHART_KEY, full_refresh, [=](){
+    draw_history_chart(full_refresh, title, span_label, samples, sequence, min_span, precision);
+  }});
+}
+
+
+/**
+ * @brief Prints the configuration menu. If it isn't a full refresh, only the menus that differ from the
+ *        ones drawn are redrawn, so a newer request can replace a pending one without losing changes.
+ *
+ * @param[in] full_refresh True if all the window have to be reloaded, False if only the
+ *                         menus texts and/or the selected menu has to be reloaded.
+ * @param[in] menus The menus that have to be printed.
+ * @param[in] selected The menu currently selected. The count starts at 0.
+ */
+void TFTDisplay::print_conf_menu(bool full_refresh, std::vector<std::string> menus, int selected){
+  render_queue.push({full_refresh ? NO_KEY : CONF_MENU_KEY, full_refresh, [=](){
+    draw_conf_menu(full_refresh, menus, selected);
+  }});
+}
+
+
+/**
+ * @brief Prints a text in the center of the window. '\n' characters will be takes as breaklines
+ *        and a multiline text will be printed.
+ *
+ * @param[in] title The text to be represented.
+ * @param[in] size The text size. Can be 1 (small) or 2 (big). Greater values will be truncated
+ *                 to 2.
+ */
+void TFTDisplay::print_centered_title(std::string title, uint8_t size){
+  render_queue.push({NO_KEY, true, [=](){
+    draw_centered_title(title, size);
+  }});
+}
+
+
+/**
+ * @brief Prints a yes/no menu with a title.
+ *
+ * @param[in] title The text represented as the title.
+ * @param[in] size The text size. Can be 1 (small) or 2 (big). Greater values will be truncated
+ *                 to 2.
+ */
+void TFTDisplay::print_selection_text(std::string title, int size){
+  render_queue.push({NO_KEY, true, [=](){
+    draw_selection_text(title, size);
+  }});
+}
+
+
+/**
+ * @brief Prints a menu to edit a string. It is composed by a group of rectangles where the different string
+ *        characters are located and four arrows as it can be seen in the figure below where the second char
+ *        is currently edited.
+ *
+ *      ____/_\____________
+ *   / |   |   |   |   |   | \
+ *   \ |___|___|___|___|___| /
+ *          \ /
+ *
+ *        If it isn't a full refresh, only the characters that differ from the ones drawn are redrawn, so a
+ *        newer request can replace a pending one without losing changes.
+ *
+ * @param[in] full_refresh True if all the window have to be reloaded, False if only the
+ *                         characters and/or the selected character has to be reloaded.
+ * @param[in] editable_text The text that have to be printed.
+ * @param[in] selected_char The char currently selected. The count starts at 0.
+ */
+void TFTDisplay::print_editable_text(bool full_refresh, std::string editable_text, int selected_char){
+  render_queue.push({full_refresh ? NO_KEY : EDIT_TEXT_KEY, false, [=](){  //Draws over the previous screen
+    draw_editable_text(full_refresh, editable_text, selected_char);
+  }});
+}
+
+
+/**
+ * @brief Prints a list of texts. It is composed by two arrows (one at the bottom and the other at the top)
+ *        and several texts displayed as a vertical list. If the texts doesn't fit in the fixed width, the
+ *        texts will be panned.
+ *
+ * @param[in] full_refresh True if all the window have to be reloaded, False if only the
+ *                         texts and/or the selected text has to be reloaded.
+ * @param[in] list_refresh True if the texts have to be reloaded, False if only the
+ *                            selected text has to be panned. The texts are also reloaded if
+ *                            they differ from the ones drawn.
+ * @param[in] text_list The texts that have to be printed.
+ * @param[in] exit An inline function that will be called from the render thread while panning. If it
+ *                 returns true, the panning process will finish. Panning also finishes when a newer
+ *                 screen is requested.
+ */
+void TFTDisplay::print_text_list(bool full_refresh, bool list_refresh,
+    std::vector<std::string> text_list, std::function<bool ()> exit){
+
+  //A newer list or panning makes the pending ones obsolete: the drawn texts are compared with the requested ones
+  int key = full_refresh ? NO_KEY : TEXT_LIST_KEY;
+
+  //Panning also stops when there is something newer to draw
+  auto exit_or_pending = [exit](){
+    return exit() || render_queue.size() != 0;
+  };
+
+  render_queue.push({key, full_refresh, [=](){
+    draw_text_list(full_refresh, list_refresh, text_list, exit_or_pending);
+  }});
+}
+
+
+/* Private functions ---------------------------------------------------------*/
+/**
+ * @brief Render thread. Owns the display driver once it has been initialized and draws the queued
+ *        commands until the queue is closed.
+ */
+static void render_thread_fn(){
+  DRAW_COMMAND command;
+  std::chrono::steady_clock::time_point hold_until = std::chrono::steady_clock::now();
+
+  while(render_queue.pop(&command, hold_until)){
+    //The screen is going to be redrawn from scratch, so the readouts and gauges can't reuse what they drew
+    if(command.full_screen){
+      time_readout.invalidate();
+      temp_readout.invalidate();
+      hum_readout.invalidate();
+      press_readout.invalidate();
+      alt_readout.invalidate();
+      iaq_readout.invalidate();
+      temp_gauge.invalidate();
+      hum_gauge.invalidate();
+      iaq_gauge.invalidate();
+      history_chart.invalidate();
+      chart_max_readout.invalidate();
+      chart_min_readout.invalidate();
+      drawn_conf_menus.clear();
+      drawn_conf_selected = -1;
+      drawn_editable_text.clear();
+      drawn_editable_selected = -1;
+      drawn_text_list.clear();
+    }
+    if(!display_asleep && display->get_rotation() != requested_rotation)
+      display->set_rotation(requested_rotation);
+    command.draw();
+    display->get_frame_arena().reset();
+    render_queue.done();
+
+    //The next replaceable command waits until this frame has probably been sent, so the requests that arrive
+    //meanwhile replace it and the frame rate never exceeds what the SPI link can send
+    hold_until = std::chrono::steady_clock::now() + std::chrono::microseconds(display->get_flush_time_us());
+  }
+
+  display->uninit();
+}
+
+
+namespace TFTDisplay{
+
+/**
+ * @brief Draws the static elements of a screen. The first time, they are drawn over a cleared Display
+ *        with "compose" and the result is kept as a template. The next times, the template is drawn
+ *        directly, so only the regions that differ from the previous screen reach the Display. The
+ *        template is composed again if main_color or background_color change. Templates only have both
+ *        colors, so they are kept as 1 bit per pixel bitmaps; if one had other colors it would not be kept
+ *        and it would be composed every time.
+ *
+ * @param[in] template_id The screen.
+ * @param[in] compose Function that draws the static elements of the screen.
+ */
+static void draw_screen_template(int template_id, std::function<void ()> compose){
+
+  SCREEN_TEMPLATE &screen = screen_templates[template_id];
+  uint16_t main16 = main_color[0] | (main_color[1] << 8);
+  uint16_t background16 = background_color[0] | (background_color[1] << 8);
+
+  if(!screen.bits.empty() && screen.main_color == main16 && screen.background_color == background16){
+    display->load_screen(screen.bits, main_color, background_color);
+    return;
+  }
+
+  display->reset_region(0, 0, 240, 240, background_color);
+  compose();
+  display->save_screen(&screen.bits, main_color, background_color);
+  screen.main_color = main16;
+  screen.background_color = background16;
+}
+
+
+/**
+ * @brief Draws the elements shared by all the main menus: the position indicator and the
+ *        configuration icon.
+ *
+ * @param[in] indicator_position Position of the menu in the indicator. The count starts at 1.
+ */
+static void compose_main_menu(int indicator_position){
+
+  ArenaSpan<uint8_t> icon = Icons::get_main_menu_indicator_icon(indicator_position, display->get_frame_arena());
+  display->draw_icon_col(
+      72, 16, Icons::main_menu_indicator_width, icon.data(), icon.size(), background_color, main_color);
+  display->draw_icon_col(
+      60, 198, Icons::main_conf_icon_width, Icons::main_conf_icon.data(), Icons::main_conf_icon.size(),
+      background_color, main_color);
+}
+
+
+/**
+ * @brief Formats a number as the readouts show it: with a fixed number of decimals and a decimal comma.
+ *        The result fits in the internal buffer of std::string, so no memory is allocated.
+ *
+ * @param[in] value The number.
+ * @param[in] precision The number of decimals.
+ * @param[in] suffix Text appended to the number, e.g. its units.
+ *
+ * @return The formatted number.
+ */
+static std::string format_decimal(float value, int precision, const char suffix[]){
+
+  char buffer[32];
+  snprintf(buffer, sizeof(buffer), "%.*f%s", precision, value, suffix);
+  std::replace(buffer, buffer + strlen(buffer), '.', ',');
+  return buffer;
+}
+
+
+/**
+ * @brief Draws the elements requested with TFTDisplay::print_main_menu_time. Runs in the render thread.
+ */
+static void draw_main_menu_time(bool full_refresh, std::string time){
 
   if(full_refresh){
-    Display_driver::reset_region(0, 0, 240, 240, background_color);
-    std::vector<uint16_t> icon = Icons::get_main_menu_indicator_icon(2);
-    Display_driver::draw_icon_col(
-        72, 16, Icons::main_menu_indicator_width, icon.data(), icon.size(), background_color, main_color);
-    Display_driver::draw_icon_col(
-        60, 198, Icons::main_conf_icon_width, Icons::main_conf_icon.data(), Icons::main_conf_icon.size(),
-        background_color, main_color);
+    draw_screen_template(TIME_TEMPLATE, [](){
+      compose_main_menu(1);
+      display->draw_icon_col(
+          70, 40, Icons::clock_icon_width, Icons::clock_icon.data(), Icons::clock_icon.size(),
+          background_color, main_color);
+    });
   }
 
-  std::vector<uint16_t> temp_icon = Icons::get_temperature_icon(percentage);
+  time_readout.write(*display, time, main_color, background_color);
+
+  display->flush();
+}
 
-  std::stringstream stream;
-  stream << std::fixed << std::setprecision(2) << temp;
-  std::string temp_string = stream.str();
-  std::replace(temp_string.begin(), temp_string.end(), '.', ',');
+
+/**
+ * @brief Draws the elements requested with TFTDisplay::print_main_menu_temp. Runs in the render thread.
+ */
+static void draw_main_menu_temp(bool full_refresh, float temp, uint8_t percentage){
+
+  if(full_refresh){
+    draw_screen_template(TEMP_TEMPLATE, [](){ compose_main_menu(2); });
+  }
+
+  std::string temp_string = format_decimal(temp, 2, "");
 
   uint8_t *color;
   if(percentage < 25)
@@ -128,26 +614,20 @@ void TFTDisplay::print_main_menu_temp(bool full_refresh, float temp, uint8_t per
   else
     color = range_75_100_temp_color;
 
-  Display_driver::draw_icon_col(
-      25, 60, Icons::temp_icon_width, temp_icon.data(), temp_icon.size(), background_color, color);
-  Display_driver::draw_icon_col(
+  temp_gauge.draw(*display, percentage, background_color, color);
+  display->draw_icon_col(
       110, 115, Icons::celsius_icon_width, Icons::celsius_icon.data(), Icons::celsius_icon.size(),
       background_color, color);
-  Display_driver::write_string_with_min_width(
-      100, 90, 140, (char*) temp_string.c_str(), color, background_color, FreeSansBold24pt7b);
+  temp_readout.write(*display, temp_string, color, background_color);
 
+  display->flush();
 }
 
 
 /**
- * @brief Prints in the Display all the elements associated to the humidity main menu
- *
- * @param[in] full_refresh True if all the window have to be reloaded, False if only the humidity,
- *                         bar and color has to be reloaded.
- * @param[in] hum The humidity percentage as a float. This value will be rounded to 2 decimals.
- *                Percentages greater than 100 will be truncated to 100.
+ * @brief Draws the elements requested with TFTDisplay::print_main_menu_hum. Runs in the render thread.
  */
-void TFTDisplay::print_main_menu_hum(bool full_refresh, float hum){
+static void draw_main_menu_hum(bool full_refresh, float hum){
 
   int precision, percentage = hum;
 
@@ -157,21 +637,10 @@ void TFTDisplay::print_main_menu_hum(bool full_refresh, float hum){
     precision = 2;
 
   if(full_refresh){
-    Display_driver::reset_region(0, 0, 240, 240, background_color);
-    std::vector<uint16_t> icon = Icons::get_main_menu_indicator_icon(3);
-    Display_driver::draw_icon_col(
-        72, 16, Icons::main_menu_indicator_width, icon.data(), icon.size(), background_color, main_color);
-    Display_driver::draw_icon_col(
-        60, 198, Icons::main_conf_icon_width, Icons::main_conf_icon.data(), Icons::main_conf_icon.size(),
-        background_color, main_color);
+    draw_screen_template(HUM_TEMPLATE, [](){ compose_main_menu(3); });
   }
 
-  std::vector<uint16_t> hum_icon = Icons::get_humidity_icon(percentage);
-
-  std::stringstream stream;
-  stream << std::fixed << std::setprecision(precision) << hum;
-  std::string hum_string = stream.str();
-  std::replace(hum_string.begin(), hum_string.end(), '.', ',');
+  std::string hum_string = format_decimal(hum, precision, "");
 
   uint8_t *color;
   if(percentage < 25)
@@ -183,105 +652,70 @@ void TFTDisplay::print_main_menu_hum(bool full_refresh, float hum){
   else
     color = range_75_100_hum_color;
 
-  Display_driver::draw_icon_col(
-      20, 60, Icons::hum_icon_width, hum_icon.data(), hum_icon.size(), background_color, color);
-  Display_driver::draw_icon_col(
+  hum_gauge.draw(*display, percentage, background_color, color);
+  display->draw_icon_col(
       130, 115, Icons::percentage_icon_width, Icons::percentage_icon.data(), Icons::percentage_icon.size(),
       background_color, color);
-  Display_driver::write_string_with_min_width(
-      110, 100, 130, (char*) hum_string.c_str(), color, background_color, FreeSansBold24pt7b);
+  hum_readout.write(*display, hum_string, color, background_color);
+
+  display->flush();
 }
 
 
 /**
- * @brief Prints in the Display all the elements associated to the pressure main menu
- *
- * @param[in] full_refresh True if all the window have to be reloaded, False if only the pressure
- *                         has to be reloaded.
- * @param[in] press The pressure as a float. This value will be rounded to 2 decimals.
+ * @brief Draws the elements requested with TFTDisplay::print_main_menu_press. Runs in the render thread.
  */
-void TFTDisplay::print_main_menu_press(bool full_refresh, float press){
+static void draw_main_menu_press(bool full_refresh, float press){
 
   if(full_refresh){
-    Display_driver::reset_region(0, 0, 240, 240, background_color);
-    std::vector<uint16_t> icon = Icons::get_main_menu_indicator_icon(4);
-    Display_driver::draw_icon_col(
-        72, 16, Icons::main_menu_indicator_width, icon.data(), icon.size(), background_color, main_color);
-    Display_driver::draw_icon_col(
-        60, 198, Icons::main_conf_icon_width, Icons::main_conf_icon.data(), Icons::main_conf_icon.size(),
-        background_color, main_color);
-    Display_driver::draw_icon_col(
-        56, 45, Icons::pressure_icon_width, Icons::pressure_icon.data(), Icons::pressure_icon.size(),
-        background_color, main_color);
+    draw_screen_template(PRESS_TEMPLATE, [](){
+      compose_main_menu(4);
+      display->draw_icon_col(
+          56, 45, Icons::pressure_icon_width, Icons::pressure_icon.data(), Icons::pressure_icon.size(),
+          background_color, main_color);
+    });
   }
 
-  std::stringstream stream;
-  stream << std::fixed << std::setprecision(2) << press << " Pa";
-  std::string press_string = stream.str();
-  std::replace(press_string.begin(), press_string.end(), '.', ',');
+  std::string press_string = format_decimal(press, 2, " Pa");
+
+  press_readout.write(*display, press_string, main_color, background_color);
 
-  Display_driver::write_string_centered_with_min_width(
-      165, 220, (char*)press_string.c_str(), main_color, background_color, FreeSansBold18pt7b);
+  display->flush();
 }
 
 
 /**
- * @brief Prints in the Display all the elements associated to the altitude main menu
- *
- * @param[in] full_refresh True if all the window have to be reloaded, False if only the
- *                         altitude has to be reloaded.
- * @param[in] alt The altitude as a float. This value will be rounded to 2 decimals.
+ * @brief Draws the elements requested with TFTDisplay::print_main_menu_alt. Runs in the render thread.
  */
-void TFTDisplay::print_main_menu_alt(bool full_refresh, float alt){
+static void draw_main_menu_alt(bool full_refresh, float alt){
 
   if(full_refresh){
-    Display_driver::reset_region(0, 0, 240, 240, background_color);
-    std::vector<uint16_t> icon = Icons::get_main_menu_indicator_icon(5);
-    Display_driver::draw_icon_col(
-        72, 16, Icons::main_menu_indicator_width, icon.data(), icon.size(), background_color, main_color);
-    Display_driver::draw_icon_col(
-        60, 198, Icons::main_conf_icon_width, Icons::main_conf_icon.data(), Icons::main_conf_icon.size(),
-        background_color, main_color);
-    Display_driver::draw_icon_col(
-        56, 45, Icons::altitude_icon_width, Icons::altitude_icon.data(), Icons::altitude_icon.size(),
-        background_color, main_color);
+    draw_screen_template(ALT_TEMPLATE, [](){
+      compose_main_menu(5);
+      display->draw_icon_col(
+          56, 45, Icons::altitude_icon_width, Icons::altitude_icon.data(), Icons::altitude_icon.size(),
+          background_color, main_color);
+    });
   }
 
-  std::stringstream stream;
-  stream << std::fixed << std::setprecision(2) << alt << " m";
-  std::string temp_string = stream.str();
-  std::replace(temp_string.begin(), temp_string.end(), '.', ',');
+  std::string temp_string = format_decimal(alt, 2, " m");
+
+  alt_readout.write(*display, temp_string, main_color, background_color);
 
-  Display_driver::write_string_centered_with_min_width(
-      180, 200, (char*)temp_string.c_str(), main_color, background_color, FreeSansBold18pt7b);
+  display->flush();
 }
 
 
 /**
- * @brief Prints in the Display all the elements associated to the IAQ main menu
- *
- * @param[in] full_refresh True if all the window have to be reloaded, False if only the IAQ,
- *                         bar and color has to be reloaded.
- * @param[in] iaq The IAQ as a float. This value will be rounded to 2 decimals.
+ * @brief Draws the elements requested with TFTDisplay::print_main_menu_iaq. Runs in the render thread.
  */
-void TFTDisplay::print_main_menu_iaq(bool full_refresh, float iaq){
+static void draw_main_menu_iaq(bool full_refresh, float iaq){
 
   if(full_refresh){
-    Display_driver::reset_region(0, 0, 240, 240, background_color);
-    std::vector<uint16_t> icon = Icons::get_main_menu_indicator_icon(6);
-    Display_driver::draw_icon_col(
-        72, 16, Icons::main_menu_indicator_width, icon.data(), icon.size(), background_color, main_color);
-    Display_driver::draw_icon_col(
-        60, 198, Icons::main_conf_icon_width, Icons::main_conf_icon.data(), Icons::main_conf_icon.size(),
-        background_color, main_color);
+    draw_screen_template(IAQ_TEMPLATE, [](){ compose_main_menu(6); });
   }
 
-  std::vector<uint16_t> iaq_icon = Icons::get_iaq_icon(iaq);
-
-  std::stringstream stream;
-  stream << std::fixed << std::setprecision(2) << iaq;
-  std::string iaq_string = stream.str();
-  std::replace(iaq_string.begin(), iaq_string.end(), '.', ',');
+  std::string iaq_string = format_decimal(iaq, 2, "");
   uint8_t *color;
   if(iaq < 51)
     color = range_0_50_iaq_color;
@@ -298,109 +732,108 @@ void TFTDisplay::print_main_menu_iaq(bool full_refresh, float iaq){
   else
     color = range_351_plus_iaq_color;
 
-  Display_driver::draw_icon_col(
-      120 - Icons::iaq_icon_width/2, 45, Icons::iaq_icon_width, iaq_icon.data(), iaq_icon.size(),
-      background_color, color);
-  Display_driver::write_string_centered_with_min_width(
-      180, 200, (char*) iaq_string.c_str(), color, background_color, FreeSansBold18pt7b);
+  iaq_gauge.draw(*display, Icons::get_iaq_bar_percentage(iaq), background_color, color);
+  iaq_readout.write(*display, iaq_string, color, background_color);
+
+  display->flush();
 }
 
 
 /**
- * @brief Prints the configuration menu.
- *
- * @param[in] full_refresh True if all the window have to be reloaded, False if only the
- *                         menus texts and/or the selected menu has to be reloaded.
- * @param[in] menus_refresh True if the menu texts have to be reloaded, False if only the
- *                          selected menu has to be reloaded.
- * @param[in] menus The menus that have to be printed.
- * @param[in] selected The menu currently selected. The count starts at 0.
- * @param[in] prev_selected The menu that was previously selected. The count starts at 0. If
- *                          there was no different previously selected menu, set it to -1.
+ * @brief Draws the elements requested with TFTDisplay::print_history_chart. Runs in the render thread.
  */
-void TFTDisplay::print_conf_menu(bool full_refresh, bool menus_refresh, std::vector<std::string> menus,
-                                 int selected, int prev_selected){
+static void draw_history_chart(bool full_refresh, std::string title, std::string span_label,
+                               const std::vector<float> &samples, long sequence, float min_span, int precision){
+
+  if(full_refresh){
+    display->reset_region(0, 0, 240, 240, background_color);
+    display->write_string_centered(30, (char*) title.c_str(), main_color, background_color, FreeSansBold12pt7b);
+    display->write_string(140, 210, (char*) span_label.c_str(), main_color, background_color, FreeSansBold12pt7b);
+    display->reset_region(19, 65, 221, 66, main_color);      //Frame of the chart
+    display->reset_region(19, 186, 221, 187, main_color);
+    display->reset_region(19, 66, 20, 186, main_color);
+    display->reset_region(220, 66, 221, 186, main_color);
+  }
+
+  history_chart.draw(*display, samples, sequence, min_span, chart_color, background_color);
+  if(!samples.empty()){
+    chart_max_readout.write(*display, format_decimal(history_chart.get_scale_max(), precision, ""), main_color,
+        background_color);
+    chart_min_readout.write(*display, format_decimal(history_chart.get_scale_min(), precision, ""), main_color,
+        background_color);
+  }
+
+  display->flush();
+}
 
 
+/**
+ * @brief Draws the elements requested with TFTDisplay::print_conf_menu. Runs in the render thread.
+ */
+static void draw_conf_menu(bool full_refresh, const std::vector<std::string> &menus, int selected){
+
   if(full_refresh){
-    Display_driver::reset_region(0, 0, 240, 240, background_color);
-    Display_driver::draw_icon_col(35, 35, 170, Icons::menu_square_icon.data(), Icons::menu_square_icon.size(),
-        background_color, main_color);
-    Display_driver::draw_icon_col(2, 60, 30, Icons::menu_back_icon.data(), Icons::menu_back_icon.size(),
-        background_color, main_color);
-    Display_driver::draw_icon_col(208, 60, 30, Icons::menu_ok_icon.data(), Icons::menu_ok_icon.size(),
-        background_color, main_color);
-    Display_driver::draw_icon_col(60, 2, 120, Icons::menu_up_icon.data(), Icons::menu_up_icon.size(),
-        background_color, main_color);
-    Display_driver::draw_icon_col(60, 208, 120, Icons::menu_down_icon.data(), Icons::menu_down_icon.size(),
-        background_color, main_color);
+    draw_screen_template(CONF_MENU_TEMPLATE, [](){
+      display->draw_icon_col(35, 35, 170, Icons::menu_square_icon.data(), Icons::menu_square_icon.size(),
+          background_color, main_color);
+      display->draw_icon_col(2, 60, 30, Icons::menu_back_icon.data(), Icons::menu_back_icon.size(),
+          background_color, main_color);
+      display->draw_icon_col(208, 60, 30, Icons::menu_ok_icon.data(), Icons::menu_ok_icon.size(),
+          background_color, main_color);
+      display->draw_icon_col(60, 2, 120, Icons::menu_up_icon.data(), Icons::menu_up_icon.size(),
+          background_color, main_color);
+      display->draw_icon_col(60, 208, 120, Icons::menu_down_icon.data(), Icons::menu_down_icon.size(),
+          background_color, main_color);
+    });
   }
 
   int menus_count = std::min(max_conf_menus, int(menus.size()));
 
-  if(full_refresh || menus_refresh){
-    for(int i = 0; i < menus_count; i++){
-      if(selected != i){
-        Display_driver::reset_region(44, 44 + i * 39, 196, 79 + i * 39, background_color);
-        Display_driver::write_string(
-              45,
-              conf_menu_y_offset + 40 * i,
-              (char*)menus[i].c_str(),
-              main_color,
-              background_color,
-              FreeSansBold12pt7b
-            );
-      }
-      else{
-        Display_driver::reset_region(44, 44 + i * 39, 196, 79 + i * 39, main_color);
-        Display_driver::write_string(
-              45,
-              conf_menu_y_offset + 40 * i,
-              (char*)menus[i].c_str(),
-              background_color,
-              main_color,
-              FreeSansBold12pt7b
-            );
-      }
-    }
-  }
-  else{
-    if(prev_selected >= 0 && prev_selected < menus_count){
-      Display_driver::reset_region(44, 44 + prev_selected * 39, 196, 79 + prev_selected * 39, background_color);
-      Display_driver::write_string(
-            45,
-            conf_menu_y_offset + 40 * prev_selected,
-            (char*)menus[prev_selected].c_str(),
-            main_color,
-            background_color,
-            FreeSansBold12pt7b
-          );
-    }
+  //Only the rows whose text or selection differ from the drawn ones are redrawn
+  for(int i = 0; i < menus_count; i++){
+    bool text_changed = i >= int(drawn_conf_menus.size()) || drawn_conf_menus[i] != menus[i];
+    bool selection_changed = (i == selected) != (i == drawn_conf_selected);
 
-    Display_driver::reset_region(44, 44 + selected * 39, 196, 79 + selected * 39, main_color);
-    Display_driver::write_string(
-          45,
-          conf_menu_y_offset + 40 * selected,
-          (char*)menus[selected].c_str(),
-          background_color,
-          main_color,
-          FreeSansBold12pt7b
-        );
+    if(full_refresh || text_changed || selection_changed)
+      draw_conf_menu_row(menus, i, i == selected);
   }
+
+  drawn_conf_menus.assign(menus.begin(), menus.begin() + menus_count);
+  drawn_conf_selected = selected;
+
+  display->flush();
 }
 
 
 /**
- * @brief Prints a text in the center of the window. '\n' characters will be takes as breaklines
- *        and a multiline text will be printed.
+ * @brief Draws one row of the configuration menu. Runs in the render thread.
  *
- * @param[in] title The text to be represented.
- * @param[in] size The text size. Can be 1 (small), 2 (medium) or 3 (big). Greater values will
- *                 be truncated to 3.
+ * @param[in] menus The menus.
+ * @param[in] row The row to draw. The count starts at 0.
+ * @param[in] selected True if the row is the selected menu.
  */
-void TFTDisplay::print_centered_title(std::string title, uint8_t size){
+static void draw_conf_menu_row(const std::vector<std::string> &menus, int row, bool selected){
+  uint8_t *color = selected ? background_color : main_color;
+  uint8_t *background = selected ? main_color : background_color;
+
+  display->reset_region(44, 44 + row * 39, 196, 79 + row * 39, background);
+  display->write_string(
+        45,
+        conf_menu_y_offset + 40 * row,
+        (char*)menus[row].c_str(),
+        color,
+        background,
+        FreeSansBold12pt7b
+      );
+}
 
-  Display_driver::reset_region(0, 0, 240, 240, background_color);
+
+/**
+ * @brief Draws the elements requested with TFTDisplay::print_centered_title. Runs in the render thread.
+ */
+static void draw_centered_title(std::string title, uint8_t size){
+
+  display->reset_region(0, 0, 240, 240, background_color);
 
   std::vector<std::string> lines;
 
@@ -411,190 +844,160 @@ void TFTDisplay::print_centered_title(std::string title, uint8_t size){
   while(std::getline(ss, item,'\n'))
     lines.push_back(item);
 
-  GFXfont font;
-  if(size <= 1)
-    font = FreeSansBold12pt7b;
-  else if(size == 2)
-    font = FreeSansBold18pt7b;
-  else
-    font = FreeSansBold24pt7b;
+  const Font &font = size <= 1 ? FreeSansBold12pt7b : FreeSansBold18pt7b;
 
-  int init_y = 125 - (lines.size()-1)*font.yAdvance/2;
+  int init_y = 125 - (lines.size()-1)*font.y_advance/2;
   for(uint8_t i = 0; i < lines.size(); i++){
-    Display_driver::write_string_centered(
-        init_y + font.yAdvance * i,(char*) lines[i].c_str(), main_color,
+    display->write_string_centered(
+        init_y + font.y_advance * i,(char*) lines[i].c_str(), main_color,
         background_color, font);
   }
+
+  display->flush();
 }
 
 
 /**
- * @brief Prints a yes/no menu with a title.
- *
- * @param[in] title The text represented as the title.
- * @param[in] size The text size. Can be 1 (small), 2 (medium) or 3 (big). Greater values will
- *                 be truncated to 3.
+ * @brief Draws the elements requested with TFTDisplay::print_selection_text. Runs in the render thread.
  */
-void TFTDisplay::print_selection_text(std::string title, int size){
+static void draw_selection_text(std::string title, int size){
 
-  Display_driver::reset_region(0, 0, 240, 240, background_color);
+  display->reset_region(0, 0, 240, 240, background_color);
 
 
   if(size <= 1){
-    Display_driver::write_string_centered(
+    display->write_string_centered(
         75,(char*) title.c_str(), main_color, background_color, FreeSansBold12pt7b);
   }
-  else if(size == 2){
-    Display_driver::write_string_centered(
-        75,(char*) title.c_str(), main_color, background_color, FreeSansBold18pt7b);
-  }
   else{
-    Display_driver::write_string_centered(
-        75,(char*) title.c_str(), main_color, background_color, FreeSansBold24pt7b);
+    display->write_string_centered(
+        75,(char*) title.c_str(), main_color, background_color, FreeSansBold18pt7b);
   }
 
-  Display_driver::draw_icon_col(
+  display->draw_icon_col(
       0, 100, Icons::yes_no_icon_width, Icons::yes_no_icon.data(), Icons::yes_no_icon.size(),
       background_color, main_color);
+
+  display->flush();
 }
 
 
 /**
- * @brief Prints a menu to edit a string. It is composed by a group of rectangles where the different string
- *        characters are located and four arrows as it can be seen in the figure below where the second char
- *        is currently edited.
- *
- *      ____/_\____________
- *   / |   |   |   |   |   | \
- *   \ |___|___|___|___|___| /
- *          \ /
- *
- * @param[in] full_refresh True if all the window have to be reloaded, False if only the
- *                         characters and/or the selected character has to be reloaded.
- * @param[in] letters_refresh True if the characters have to be reloaded, False if only the
- *                            selected char has to be reloaded.
- * @param[in] editable_text The text that have to be printed.
- * @param[in] selected_char The char currently selected. The count starts at 0.
- * @param[in] prev_selected_char The char that was previously selected. The count starts at 0. If
- *                               there was no different previously selected char, set it to -1.
+ * @brief Draws the elements requested with TFTDisplay::print_editable_text. Runs in the render thread.
  */
-void TFTDisplay::print_editable_text(bool full_refresh, bool letters_refresh,
-                                     std::string editable_text, int selected_char, int prev_selected_char){
+static void draw_editable_text(bool full_refresh, const std::string &editable_text, int selected_char){
 
   if(full_refresh){
-    Display_driver::reset_region(0, 100, 240, 140, background_color);
+    display->reset_region(0, 100, 240, 140, background_color);
 
-    Display_driver::draw_icon_col(1, 98, Icons::edit_menu_left_width, Icons::edit_menu_left.data(),
+    display->draw_icon_col(1, 98, Icons::edit_menu_left_width, Icons::edit_menu_left.data(),
         Icons::edit_menu_left.size(), background_color, main_color);
-    Display_driver::draw_icon_col(214, 98, Icons::edit_menu_right_width, Icons::edit_menu_right.data(),
+    display->draw_icon_col(214, 98, Icons::edit_menu_right_width, Icons::edit_menu_right.data(),
         Icons::edit_menu_right.size(), background_color, main_color);
-    Display_driver::draw_icon_col(26, 98, Icons::edit_menu_square_width, Icons::edit_menu_square.data(),
+    display->draw_icon_col(26, 98, Icons::edit_menu_square_width, Icons::edit_menu_square.data(),
         Icons::edit_menu_square.size(), background_color, main_color);
+
+    drawn_editable_text.clear();
+    drawn_editable_selected = -1;
   }
 
-  if(full_refresh || letters_refresh){
-    int size = std::min(max_chars_edit_menu, int(editable_text.size()));
-    for(int i = 0; i < size; i++){
-      std::string char_string = editable_text.substr(i, 1);
-      GFXglyph glyph = FreeSansBold18pt7b.glyph[char(char_string[0]) - FreeSansBold18pt7b.first];
-
-      if(selected_char == i){
-        Display_driver::reset_region(28 + 37*i, 100, 64 + 37*i, 140, main_color);
-
-        Display_driver::write_string(
-            46 + 37*i - glyph.width/2 - glyph.xOffset, 130,
-            (char *)char_string.c_str(), background_color, main_color, FreeSansBold18pt7b);
-
-        Display_driver::draw_icon_col(
-            28 + 37*i, 70, Icons::edit_menu_up_width, Icons::edit_menu_up.data(), Icons::edit_menu_up.size(),
-            background_color, main_color);
-        Display_driver::draw_icon_col(
-            28 + 37*i, 146, Icons::edit_menu_down_width, Icons::edit_menu_down.data(), Icons::edit_menu_down.size(),
-            background_color, main_color);
-      }
-      else{
-        Display_driver::reset_region(28 + 37*i, 100, 64 + 37*i, 140, background_color);
-        Display_driver::write_string(
-            46 + 37*i - glyph.width/2 - glyph.xOffset, 130,
-            (char *)char_string.c_str(), main_color, background_color, FreeSansBold18pt7b);
-      }
-    }
+  int size = std::min(max_chars_edit_menu, int(editable_text.size()));
+
+  //Only the chars whose value or selection differ from the drawn ones are redrawn
+  for(int i = 0; i < size; i++){
+    bool char_changed = i >= int(drawn_editable_text.size()) || drawn_editable_text[i] != editable_text[i];
+    bool was_selected = i == drawn_editable_selected;
+
+    if(char_changed || (i == selected_char) != was_selected)
+      draw_editable_char(editable_text, i, i == selected_char, was_selected);
   }
-  else{
-    if(prev_selected_char >= 0 && prev_selected_char < max_chars_edit_menu){
-      std::string prev_sel_char = editable_text.substr(prev_selected_char, 1);
-      GFXglyph glyph = FreeSansBold18pt7b.glyph[char(prev_sel_char[0]) - FreeSansBold18pt7b.first];
-
-      Display_driver::reset_region(28 + 37*prev_selected_char, 100, 64 + 37*prev_selected_char, 140, background_color);
-      Display_driver::reset_region(28 + 37*prev_selected_char, 70, 64 + 37*prev_selected_char, 94, background_color);
-      Display_driver::reset_region(28 + 37*prev_selected_char, 146, 64 + 37*prev_selected_char, 170, background_color);
-      Display_driver::write_string(
-          46 + 37*prev_selected_char - glyph.width/2 - glyph.xOffset, 130,
-          (char *)prev_sel_char.c_str(), main_color, background_color, FreeSansBold18pt7b);
-    }
 
-    std::string sel_char = editable_text.substr(selected_char, 1);
-    GFXglyph glyph = FreeSansBold18pt7b.glyph[char(sel_char[0]) - FreeSansBold18pt7b.first];
+  drawn_editable_text = editable_text.substr(0, size);
+  drawn_editable_selected = selected_char;
+
+  display->flush();
+}
+
 
-    Display_driver::reset_region(28 + 37*selected_char, 100, 64 + 37*selected_char, 140, main_color);
+/**
+ * @brief Draws one char of the menu to edit a string and, if it is selected, its arrows. Runs in the
+ *        render thread.
+ *
+ * @param[in] editable_text The text.
+ * @param[in] position The char to draw. The count starts at 0.
+ * @param[in] selected True if the char is the one currently selected.
+ * @param[in] was_selected True if the char was drawn as selected, so its arrows have to be removed.
+ */
+static void draw_editable_char(const std::string &editable_text, int position, bool selected, bool was_selected){
+  std::string char_string = editable_text.substr(position, 1);
+  FontGlyph glyph = FreeSansBold18pt7b.glyph[char(char_string[0]) - FreeSansBold18pt7b.first];
+  int x = 28 + 37*position;
 
-    Display_driver::write_string(
-        46 + 37*selected_char - glyph.width/2 - glyph.xOffset, 130,
-        (char *)sel_char.c_str(), background_color, main_color, FreeSansBold18pt7b);
+  if(selected){
+    display->reset_region(x, 100, x + 36, 140, main_color);
 
-    Display_driver::draw_icon_col(
-        28 + 37*selected_char, 70, Icons::edit_menu_up_width, Icons::edit_menu_up.data(),
-        Icons::edit_menu_up.size(), background_color, main_color);
-    Display_driver::draw_icon_col(
-        28 + 37*selected_char, 146, Icons::edit_menu_down_width, Icons::edit_menu_down.data(),
-        Icons::edit_menu_down.size(), background_color, main_color);
+    display->write_string(
+        x + 18 - glyph.width/2 - glyph.x_offset, 130,
+        (char *)char_string.c_str(), background_color, main_color, FreeSansBold18pt7b);
+
+    display->draw_icon_col(
+        x, 70, Icons::edit_menu_up_width, Icons::edit_menu_up.data(), Icons::edit_menu_up.size(),
+        background_color, main_color);
+    display->draw_icon_col(
+        x, 146, Icons::edit_menu_down_width, Icons::edit_menu_down.data(), Icons::edit_menu_down.size(),
+        background_color, main_color);
+  }
+  else{
+    display->reset_region(x, 100, x + 36, 140, background_color);
+    if(was_selected){
+      display->reset_region(x, 70, x + 36, 94, background_color);
+      display->reset_region(x, 146, x + 36, 170, background_color);
+    }
+    display->write_string(
+        x + 18 - glyph.width/2 - glyph.x_offset, 130,
+        (char *)char_string.c_str(), main_color, background_color, FreeSansBold18pt7b);
   }
 }
 
 
 /**
- * @brief Prints a list of texts. It is composed by two arrows (one at the bottom and the other at the top)
- *        and several texts displayed as a vertical list. If the texts doesn't fit in the fixed width, the
- *        texts will be panned.
- *
- * @param[in] full_refresh True if all the window have to be reloaded, False if only the
- *                         texts and/or the selected text has to be reloaded.
- * @param[in] list_refresh True if the texts have to be reloaded, False if only the
- *                            selected text has to be reloaded.
- * @param[in] text_list The texts that have to be printed.
- * @param[in] exit An inline function that will be called every panning cycle. If it returns true,
- *                 the panning process will finish.
+ * @brief Draws the elements requested with TFTDisplay::print_text_list. Runs in the render thread.
  */
-void TFTDisplay::print_text_list(bool full_refresh, bool list_refresh,
-    std::vector<std::string> text_list, std::function<bool ()> exit){
+static void draw_text_list(bool full_refresh, bool list_refresh,
+                           const std::vector<std::string> &text_list, std::function<bool ()> exit){
 
   if(full_refresh){
-    Display_driver::reset_region(0, 0, 240, 240, background_color);
+    display->reset_region(0, 0, 240, 240, background_color);
 
-    Display_driver::draw_icon_col(60, 22, 120, Icons::menu_up_icon.data(), Icons::menu_up_icon.size(),
+    display->draw_icon_col(60, 22, 120, Icons::menu_up_icon.data(), Icons::menu_up_icon.size(),
         background_color, main_color);
-    Display_driver::draw_icon_col(60, 188, 120, Icons::menu_down_icon.data(), Icons::menu_down_icon.size(),
+    display->draw_icon_col(60, 188, 120, Icons::menu_down_icon.data(), Icons::menu_down_icon.size(),
         background_color, main_color);
   }
 
-  if(full_refresh || list_refresh){
+  //A pan request may have replaced a pending list refresh, so the list is redrawn if it isn't the drawn one
+  if(full_refresh || list_refresh || text_list != drawn_text_list){
     for(int i = 0; i < max_text_list_elements; i++){
       if(central_text_list_element == i){
-        Display_driver::reset_region(30, 52 + 47*i, 210, 94 + 47*i, main_color);
-        Display_driver::write_string_truncated(
+        display->reset_region(30, 52 + 47*i, 210, 94 + 47*i, main_color);
+        display->write_string_truncated(
             30, 80 + 47*i, 180, (char *)text_list[i].c_str(), background_color, main_color, FreeSansBold12pt7b);
       }
       else{
-        Display_driver::reset_region(30, 52 + 47*i, 210, 94 + 47*i, background_color);
-        Display_driver::write_string_truncated(
+        display->reset_region(30, 52 + 47*i, 210, 94 + 47*i, background_color);
+        display->write_string_truncated(
             30, 80 + 47*i, 180, (char *)text_list[i].c_str(), main_color, background_color, FreeSansBold12pt7b);
       }
     }
+    drawn_text_list = text_list;
   }
   else{
-    Display_driver::write_panning_string(
+    display->write_panning_string(
           30, 80 + 47*central_text_list_element, 180, 3,
           (char *)text_list[central_text_list_element].c_str(), background_color, main_color, FreeSansBold12pt7b, exit);
   }
+
+  display->flush();
 }
 
+}
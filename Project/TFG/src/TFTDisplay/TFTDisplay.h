@@ -17,6 +17,7 @@
 #include <string>
 #include <vector>
 #include <functional>
+#include "display_driver/display_driver.h"
 
 namespace TFTDisplay{
 
@@ -44,6 +45,8 @@ extern uint8_t range_201_250_iaq_color[2];
 extern uint8_t range_251_350_iaq_color[2];
 extern uint8_t range_351_plus_iaq_color[2];
 
+extern uint8_t chart_color[2];
+
 extern const int max_conf_menus;
 extern const int max_chars_edit_menu;
 extern const int max_text_list_elements;
@@ -54,17 +57,59 @@ extern const int central_text_list_element;
 /* Exported macro ------------------------------------------------------------*/
 /* Exported Functions --------------------------------------------------------*/
 /**
- * @brief Initializes the display with a black background.
+ * @brief Selects the panel where the screens are drawn. By default they are drawn in the panel connected to
+ *        spidev0.0 with the DC line in GPIO17, which is only created by start if this function hasn't been
+ *        called. Must be called before start and the display must remain valid until end returns.
+ *
+ * @param[in] new_display The display.
+ */
+void set_display(Display_driver *new_display);
+
+
+/**
+ * @brief Rotates the contents of the Display. The rotation is done by the panel, so the current screen is
+ *        only sent again, in the new orientation, without being redrawn. Can be called before start.
+ *
+ * @param[in] rotation The rotation.
+ */
+void set_rotation(DISPLAY_ROTATION rotation);
+
+
+/**
+ * @brief Initializes the display with a black background and starts the render thread. From now on,
+ *        the print functions only queue the requested screen and return. The render thread draws the
+ *        queued screens in order, skipping the ones that a newer request makes obsolete.
  */
 void start();
 
 
 /**
- * @brief Ends SPI communications and release all the related resources.
+ * @brief Draws the pending screens, stops the render thread and releases all the display resources.
  */
 void end();
 
 
+/**
+ * @brief Waits until all the requested screens have been drawn and sent to the Display.
+ */
+void wait_idle();
+
+
+/**
+ * @brief Turns the Display off once the pending screens have been drawn. The panel keeps the last screen in
+ *        its memory while it is off and the rotations requested meanwhile are only applied when it is
+ *        turned on, so nothing is sent to the panel while nothing new is requested.
+ */
+void sleep();
+
+
+/**
+ * @brief Turns the Display on again. The panel shows the screen it kept while it was off, so it doesn't
+ *        have to be sent again; only a rotation requested meanwhile makes it be sent in the new orientation.
+ */
+void wake();
+
+
 /**
  * @brief Prints in the Display all the elements associated to the time main menu
  *
@@ -121,29 +166,42 @@ void print_main_menu_alt(bool full_refresh, float alt);
  */
 void print_main_menu_iaq(bool full_refresh, float iaq);
 
+/**
+ * @brief Prints in the Display the history chart of a measure, with the values of its top and bottom rows.
+ *        While the same chart is shown, only the columns of the new samples are drawn.
+ *
+ * @param[in] full_refresh True if all the window have to be reloaded, False if only the new samples and the
+ *                         scale have to be reloaded.
+ * @param[in] title The title of the chart.
+ * @param[in] span_label The time shown by the chart, written below it.
+ * @param[in] samples The samples of the history, from the oldest to the newest.
+ * @param[in] sequence The number of samples added to the history since its start, as returned by
+ *                     MeasureHistory::get_samples.
+ * @param[in] min_span The minimum difference between the values of the top and bottom rows.
+ * @param[in] precision The number of decimals of the values of the top and bottom rows.
+ */
+void print_history_chart(bool full_refresh, std::string title, std::string span_label, std::vector<float> samples,
+                         long sequence, float min_span, int precision);
+
 
 /**
- * @brief Prints the configuration menu.
+ * @brief Prints the configuration menu. If it isn't a full refresh, only the menus that differ from the
+ *        ones drawn are redrawn, so a newer request can replace a pending one without losing changes.
  *
  * @param[in] full_refresh True if all the window have to be reloaded, False if only the
  *                         menus texts and/or the selected menu has to be reloaded.
- * @param[in] menus_refresh True if the menu texts have to be reloaded, False if only the
- *                          selected menu has to be reloaded.
  * @param[in] menus The menus that have to be printed.
  * @param[in] selected The menu currently selected. The count starts at 0.
- * @param[in] prev_selected The menu that was previously selected. The count starts at 0. If
- *                          there was no different previously selected menu, set it to -1.
  */
-void print_conf_menu(bool full_refresh, bool menus_refresh, std::vector<std::string> menus,
-                     int selected, int prev_selected);
+void print_conf_menu(bool full_refresh, std::vector<std::string> menus, int selected);
 
 /**
  * @brief Prints a text in the center of the window. '\n' characters will be takes as breaklines
  *        and a multiline text will be printed.
  *
  * @param[in] title The text to be represented.
- * @param[in] size The text size. Can be 1 (small), 2 (medium) or 3 (big). Greater values will
- *                 be truncated to 3.
+ * @param[in] size The text size. Can be 1 (small) or 2 (big). Greater values will be truncated
+ *                 to 2.
  */
 void print_centered_title(std::string title, uint8_t size);
 
@@ -151,8 +209,8 @@ void print_centered_title(std::string title, uint8_t size);
  * @brief Prints a yes/no menu with a title.
  *
  * @param[in] title The text represented as the title.
- * @param[in] size The text size. Can be 1 (small), 2 (medium) or 3 (big). Greater values will
- *                 be truncated to 3.
+ * @param[in] size The text size. Can be 1 (small) or 2 (big). Greater values will be truncated
+ *                 to 2.
  */
 void print_selection_text(std::string title, int size);
 
@@ -166,17 +224,15 @@ void print_selection_text(std::string title, int size);
  *   \ |___|___|___|___|___| /
  *          \ /
  *
+ *        If it isn't a full refresh, only the characters that differ from the ones drawn are redrawn, so a
+ *        newer request can replace a pending one without losing changes.
+ *
  * @param[in] full_refresh True if all the window have to be reloaded, False if only the
  *                         characters and/or the selected character has to be reloaded.
- * @param[in] letters_refresh True if the characters have to be reloaded, False if only the
- *                            selected char has to be reloaded.
  * @param[in] editable_text The text that have to be printed.
  * @param[in] selected_char The char currently selected. The count starts at 0.
- * @param[in] prev_selected_char The char that was previously selected. The count starts at 0. If
- *                               there was no different previously selected char, set it to -1.
  */
-void print_editable_text(bool full_refresh, bool letters_refresh,
-                         std::string editable_text, int selected_char, int prev_selected_char);
+void print_editable_text(bool full_refresh, std::string editable_text, int selected_char);
 
 /**
  * @brief Prints a list of texts. It is composed by two arrows (one at the bottom and the other at the top)
@@ -186,10 +242,12 @@ void print_editable_text(bool full_refresh, bool letters_refresh,
  * @param[in] full_refresh True if all the window have to be reloaded, False if only the
  *                         texts and/or the selected text has to be reloaded.
  * @param[in] list_refresh True if the texts have to be reloaded, False if only the
- *                            selected text has to be reloaded.
+ *                            selected text has to be panned. The texts are also reloaded if
+ *                            they differ from the ones drawn.
  * @param[in] text_list The texts that have to be printed.
- * @param[in] exit An inline function that will be called every panning cycle. If it returns true,
- *                 the panning process will finish.
+ * @param[in] exit An inline function that will be called from the render thread while panning. If it
+ *                 returns true, the panning process will finish. Panning also finishes when a newer
+ *                 screen is requested.
  */
 void print_text_list(bool full_refresh, bool list_refresh, std::vector<std::string> text_list,
     std::function<bool ()> exit);
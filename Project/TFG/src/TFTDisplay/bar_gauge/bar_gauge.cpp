@@ -0,0 +1,111 @@
+/**
+  ******************************************************************************
+  * @file   bar_gauge.cpp
+  * @author Pablo San Millán Fierro (pablo.sanmillanf@alumnos.upm.es)
+  * @brief  Bar gauge Module.
+  *
+  * @note   End-of-degree work.
+  *         This module draws the icons with a bar (temperature, humidity and
+  *         IAQ). It remembers the level of the bar in the Display, so a new
+  *         percentage only redraws the rows between the old and new levels.
+  ******************************************************************************
+*/
+
+/* Includes ------------------------------------------------------------------*/
+#include "bar_gauge.h" // Module header
+#include "../display_driver/display_driver.h"
+#include <algorithm>
+
+/* Private defines -----------------------------------------------------------*/
+/* Private typedef -----------------------------------------------------------*/
+/* Private variables----------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+/* Functions -----------------------------------------------------------------*/
+
+/**
+ * @brief Class constructor. Sets the bar icon and its place.
+ *
+ * @param[in] bar The bar icon.
+ * @param[in] start_x X coordinate of the top left corner of the bounding box containing the icon.
+ * @param[in] start_y Y coordinate of the top left corner of the bounding box containing the icon.
+ */
+BarGauge::BarGauge(const Icons::BAR_SHAPE &bar, int start_x, int start_y):
+    bar(bar), start_x(start_x), start_y(start_y), valid(false), level(0), color(0), background(0){
+}
+
+
+/**
+ * @brief Draws the icon with its bar filled "bar_percentage" percentage, as Display_driver::draw_icon_col
+ *        would do. If the icon is already in the Display with the same colors, only the rows of the bar
+ *        between the previous and the new level are redrawn.
+ *
+ * @param[in] display The Display where the gauge is.
+ * @param[in] bar_percentage The bar percentage. Percentages greater than 100 will be truncated to 100.
+ * @param[in] color Color of the set bits of the icon.
+ * @param[in] background_color Color of the cleared bits of the icon, including the filled part of the bar.
+ */
+void BarGauge::draw(Display_driver &display, uint8_t bar_percentage, uint8_t color[], uint8_t background_color[]){
+  uint16_t color16 = color[0] | (color[1] << 8);
+  uint16_t background16 = background_color[0] | (background_color[1] << 8);
+  int new_level = Icons::get_bar_level(bar, bar_percentage);
+
+  if(valid && color16 == this->color && background16 == background){
+    int first_row = std::min(level, new_level), end_row = std::max(level, new_level);
+
+    level = new_level;
+    if(first_row < end_row){
+      Icons::set_bar_rows(bar, first_row, end_row, level, icon.data());
+      draw_rows(display, first_row, end_row, color, background_color);
+    }
+    return;
+  }
+
+  valid = true;
+  level = new_level;
+  this->color = color16;
+  background = background16;
+
+  icon.assign(bar.icon, bar.icon + bar.icon_size);
+  Icons::set_bar_rows(bar, 0, level, level, icon.data());
+  display.draw_icon_col(start_x, start_y, bar.icon_width, icon.data(), icon.size(), color, background_color);
+}
+
+
+/**
+ * @brief Forgets the drawn icon, so the next draw redraws it completely. Must be called when something
+ *        else is drawn over the gauge, e.g. when the screen is cleared.
+ */
+void BarGauge::invalidate(){
+  valid = false;
+}
+
+
+/* Private functions ---------------------------------------------------------*/
+/**
+ * @brief Draws some rows of the bar. Only the bytes of the packed rows that contain the bar are drawn.
+ *
+ * @param[in] display The Display where the gauge is.
+ * @param[in] first_row The first row to draw. Rows are counted from the lowest one.
+ * @param[in] end_row The row after the last one to draw.
+ * @param[in] color Color of the set bits of the icon.
+ * @param[in] background_color Color of the cleared bits of the icon.
+ */
+void BarGauge::draw_rows(Display_driver &display, int first_row, int end_row, uint8_t color[],
+    uint8_t background_color[]){
+  int stride = (bar.icon_width + 7) / 8;
+  int first_byte = bar.bar_x / 8;
+  int end_byte = (bar.bar_x + bar.max_bar_width + 7) / 8;
+  int bytes = end_byte - first_byte;
+  int top = bar.bar_y - (end_row - 1);    //The icon rows grow downwards and the bar rows upwards
+  int height = end_row - first_row;
+
+  ArenaSpan<uint8_t> band = display.get_frame_arena().alloc<uint8_t>(bytes * height);
+  for(int y = 0; y < height; y++){
+    const uint8_t *row = icon.data() + (top + y) * stride;
+    std::copy(row + first_byte, row + end_byte, band.begin() + y * bytes);
+  }
+
+  int width = std::min(bytes * 8, bar.icon_width - first_byte * 8);
+  display.draw_icon_col(
+      start_x + first_byte * 8, top + start_y, width, band.data(), band.size(), color, background_color);
+}
@@ -0,0 +1,74 @@
+/**
+  ******************************************************************************
+  * @file   bar_gauge.h
+  * @author Pablo San Millán Fierro (pablo.sanmillanf@alumnos.upm.es)
+  * @brief  Bar gauge Module Header.
+  *
+  * @note   End-of-degree work.
+  *         This module draws the icons with a bar (temperature, humidity and
+  *         IAQ). It remembers the level of the bar in the Display, so a new
+  *         percentage only redraws the rows between the old and new levels.
+  ******************************************************************************
+*/
+
+#ifndef __BAR_GAUGE_H__
+#define __BAR_GAUGE_H__
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <vector>
+#include "../icon_manager/icon_manager.h"
+
+/* Exported types ------------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported Classes ----------------------------------------------------------*/
+
+class Display_driver;
+
+class BarGauge{
+  const Icons::BAR_SHAPE &bar;
+  int start_x;
+  int start_y;
+
+  bool valid;                 //False if the panel contents of the gauge are unknown
+  std::vector<uint8_t> icon;  //Packed icon as it is in the Display
+  int level;
+  uint16_t color;
+  uint16_t background;
+
+  void draw_rows(Display_driver &display, int first_row, int end_row, uint8_t color[],
+      uint8_t background_color[]);
+public:
+
+  /**
+   * @brief Class constructor. Sets the bar icon and its place.
+   *
+   * @param[in] bar The bar icon.
+   * @param[in] start_x X coordinate of the top left corner of the bounding box containing the icon.
+   * @param[in] start_y Y coordinate of the top left corner of the bounding box containing the icon.
+   */
+  BarGauge(const Icons::BAR_SHAPE &bar, int start_x, int start_y);
+
+  /**
+   * @brief Draws the icon with its bar filled "bar_percentage" percentage, as Display_driver::draw_icon_col
+   *        would do. If the icon is already in the Display with the same colors, only the rows of the bar
+   *        between the previous and the new level are redrawn.
+   *
+   * @param[in] display The Display where the gauge is.
+   * @param[in] bar_percentage The bar percentage. Percentages greater than 100 will be truncated to 100.
+   * @param[in] color Color of the set bits of the icon.
+   * @param[in] background_color Color of the cleared bits of the icon, including the filled part of the bar.
+   */
+  void draw(Display_driver &display, uint8_t bar_percentage, uint8_t color[], uint8_t background_color[]);
+
+  /**
+   * @brief Forgets the drawn icon, so the next draw redraws it completely. Must be called when something
+   *        else is drawn over the gauge, e.g. when the screen is cleared.
+   */
+  void invalidate();
+};
+
+/* Exported Functions --------------------------------------------------------*/
+
+#endif /* __BAR_GAUGE_H__ */
@@ -14,56 +14,159 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "display_driver.h"
+#include "../text_rasterizer/text_rasterizer.h"
 #include <algorithm>
-#include <vector>
+#include <chrono>
 
 /* External variables---------------------------------------------------------*/
 /* Private defines -----------------------------------------------------------*/
 /* Private typedef -----------------------------------------------------------*/
+typedef struct{
+  uint8_t madctl;       //Memory data access data
+  int x_offset;         //Column and row of the frame memory where the panel window starts
+  int y_offset;
+}ROTATION_CONFIG;
 /* Private variables----------------------------------------------------------*/
 static uint8_t mem_data_cmd[] = { 0x2C };      //Write in memory
 static uint8_t soft_reset[] = {0x01};          //Software reset
+static uint8_t sleep_in[] = {0x10};            //Enter sleep mode
 static uint8_t sleep_out[] = {0x11};           //Get out of sleep mode
 static uint8_t color_mode[] = {0x3A};          //Color mode command
 static uint8_t color_mode_data[] = {0x55};     //Color mode data
 static uint8_t mem_dat_access[] = {0x36};      //Memory data access command
-static uint8_t mem_dat_access_mode[] = {0x00}; //Memory data access data
 static uint8_t col_set_addr[] = {0x2A};        //Set column address command
 static uint8_t row_set_addr[] = {0x2B};        //Set row address command
 static uint8_t invert_on[] = {0x21};
 static uint8_t normal_mode[] = {0x13};         //Set normal mode of operation
 static uint8_t display_on[] = {0x29};          //Power on the display
-static uint8_t default_rx[5] = {0, };          //Dummy array for received data
-static uint32_t speed = 62500000;               //SPI speed
+static uint8_t display_off[] = {0x28};         //Power off the display
+static const int sleep_in_delay_us = 5000;      //Time the panel needs after SLPIN before the next command
+static const int sleep_out_delay_us = 5000;     //Time the panel needs after SLPOUT before the next command
+static const size_t frame_arena_bytes = 128 * 1024;     //Initial size of the temporary buffers of a frame
+static const int panning_period_us = 20000;     //Time between panning steps
+static const int panning_poll_us = 1000;        //Period to check the exit function while panning
+//Configuration of every DISPLAY_ROTATION. The ST7789 frame memory has 320 rows and the panel shows the first
+//240 ones, so the rotations that reverse the row order move the window to the last 240 rows.
+static const ROTATION_CONFIG rotation_configs[] = {
+  {0x00, 0, 0},         //ROTATION_0
+  {0x60, 0, 0},         //ROTATION_90: row/column exchange and column order reversed
+  {0xC0, 0, 80},        //ROTATION_180: row and column order reversed
+  {0xA0, 80, 0}         //ROTATION_270: row/column exchange and row order reversed
+};
 /* Private function prototypes -----------------------------------------------*/
-void prep_write(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y);
-std::vector<uint16_t> prepare_string(char str[], uint8_t color[], uint8_t background_color[], GFXfont font,
-    int *text_y_offset, int *width);
 /* Functions -----------------------------------------------------------------*/
 
 /**
- * @brief Initializes the display with a black background.
+ * @brief Class constructor. Nothing is sent to the panel until init_display is called.
+ *
+ * @param[in] transport Where the ST7789 command stream is sent, e.g. a SpidevTransport with the spidev
+ *                      device and the DC pin of the panel. It must remain valid until uninit returns or
+ *                      the driver is destroyed.
+ */
+Display_driver::Display_driver(DisplayTransport *transport):
+    transport(transport), rotation(ROTATION_0), window_start_x(-1), window_start_y(-1), window_end_x(-1), window_end_y(-1),
+    frame_buffer(display_width, display_height), frame_arena(frame_arena_bytes),
+    writer_busy(false), writer_exit(false), flush_time_us(0){
+}
+
+
+/**
+ * @brief Initializes the display with a black background and starts its writer thread.
  */
 void Display_driver::init_display(){
 
-	SPI_Master::spi_start(0, 0, 8, 62500000);
+	if(transport->start() == -1)
+	  fprintf(stderr, "ERROR: Couldn't start the display transport\n");
 
-	SPI_Master::send_spi_msg(soft_reset, default_rx, 1, sizeof(soft_reset), 0, speed);
+	transport->send(soft_reset, sizeof(soft_reset), 1, 0);
 
 	sleep(0.5);
 
-	SPI_Master::send_spi_msg(sleep_out, default_rx, 1, sizeof(sleep_out), 10000, speed);
-	SPI_Master::send_spi_msg(color_mode, default_rx, 1, sizeof(color_mode), 10000, speed);
-	SPI_Master::send_spi_msg(color_mode_data, default_rx, 0, sizeof(color_mode_data), 10000, speed);
-	SPI_Master::send_spi_msg(mem_dat_access, default_rx, 1, sizeof(mem_dat_access), 10000, speed);
-	SPI_Master::send_spi_msg(mem_dat_access_mode, default_rx, 0, sizeof(mem_dat_access_mode), 10000, speed);
-	SPI_Master::send_spi_msg(invert_on, default_rx, 1, sizeof(invert_on), 10000, speed);
-	SPI_Master::send_spi_msg(normal_mode, default_rx, 1, sizeof(normal_mode), 10000, speed);
-	SPI_Master::send_spi_msg(display_on, default_rx, 1, sizeof(display_on), 10000, speed);
-	SPI_Master::send_spi_msg(mem_data_cmd, default_rx, 1, sizeof(mem_data_cmd), 10000, speed);
+	transport->send(sleep_out, sizeof(sleep_out), 1, 10000);
+	transport->send(color_mode, sizeof(color_mode), 1, 10000);
+	transport->send(color_mode_data, sizeof(color_mode_data), 0, 10000);
+	transport->send(mem_dat_access, sizeof(mem_dat_access), 1, 10000);
+	transport->send(&rotation_configs[rotation].madctl, 1, 0, 10000);
+	transport->send(invert_on, sizeof(invert_on), 1, 10000);
+	transport->send(normal_mode, sizeof(normal_mode), 1, 10000);
+	transport->send(display_on, sizeof(display_on), 1, 10000);
+	transport->send(mem_data_cmd, sizeof(mem_data_cmd), 1, 10000);
+
+	window_start_x = window_start_y = window_end_x = window_end_y = -1;
+
+	writer_thread = std::thread(&Display_driver::writer_thread_fn, this);
 
 	uint8_t background_color[] = {0x00, 0x00};
-	reset_region(0, 0, 240, 240, background_color);
+	reset_region(0, 0, display_width, display_height, background_color);
+	frame_buffer.invalidate();
+	flush();
+}
+
+
+/**
+ * @brief Rotates the contents of the panel. The panel does the rotation while it stores the pixels (MADCTL),
+ *        so it has no cost per pixel; the whole frame is sent again in the next flush with the new orientation.
+ *        The panel is square, so every layout fits in every orientation. If it is called before init_display,
+ *        the rotation is applied when the panel is initialized.
+ *
+ * @param[in] new_rotation The rotation.
+ */
+void Display_driver::set_rotation(DISPLAY_ROTATION new_rotation){
+
+  //The writer thread must not be using the panel while its memory access mode changes
+  std::unique_lock<std::mutex> lock(writer_mutex);
+  writer_cond.wait(lock, [this](){ return !writer_busy; });
+
+  if(new_rotation == rotation)
+    return;
+  rotation = new_rotation;
+
+  if(!writer_thread.joinable())
+    return;
+
+  uint8_t madctl = rotation_configs[rotation].madctl;
+  send_command(mem_dat_access, &madctl, 1);
+  window_start_x = window_start_y = window_end_x = window_end_y = -1;
+  frame_buffer.invalidate();
+}
+
+
+/**
+ * @brief Turns the panel off and puts it in sleep mode after the last flush has been sent. The panel keeps
+ *        its memory while sleeping, so nothing has to be sent again when it wakes up.
+ */
+void Display_driver::sleep_display(){
+
+  std::unique_lock<std::mutex> lock(writer_mutex);
+  writer_cond.wait(lock, [this](){ return !writer_busy; });
+
+  transport->send(display_off, sizeof(display_off), 1, 0);
+  transport->send(sleep_in, sizeof(sleep_in), 1, sleep_in_delay_us);
+}
+
+
+/**
+ * @brief Wakes the panel up from sleep mode and turns it on. It shows again the last frame it received,
+ *        plus the regions flushed while sleeping.
+ */
+void Display_driver::wake_display(){
+
+  std::unique_lock<std::mutex> lock(writer_mutex);
+  writer_cond.wait(lock, [this](){ return !writer_busy; });
+
+  transport->send(sleep_out, sizeof(sleep_out), 1, sleep_out_delay_us);
+  transport->send(display_on, sizeof(display_on), 1, 0);
+}
+
+
+/**
+ * @brief Obtain the rotation of the contents of the panel.
+ *
+ * @return The rotation.
+ */
+DISPLAY_ROTATION Display_driver::get_rotation(){
+
+  return rotation;
 }
 
 
@@ -78,29 +181,23 @@ void Display_driver::init_display(){
  */
 void Display_driver::reset_region(int start_x, int start_y, int end_x, int end_y, uint8_t reset_color[]){
 
-  prep_write(start_x, start_y, end_x - 1, end_y - 1);
-
-  int reset_size = (end_x - start_x) * (end_y - start_y) * 2;
-  int msg_size = 32; //Must be even
-
-  uint8_t msg[msg_size];
-
-  for (int i = 0; i < msg_size; i++) {
-    if(i%2 == 0)
-      msg[i] = reset_color[0];
-    else
-      msg[i] = reset_color[1];
-  }
+  frame_buffer.fill(start_x, start_y, end_x, end_y, reset_color[0] | (reset_color[1] << 8));
+}
 
-  long i;
 
-  for(i = 1; i < reset_size; i += msg_size){
-    SPI_Master::send_spi_msg(msg, default_rx, 0, sizeof(msg), 0, speed);
-  }
+/**
+ * @brief Moves the contents of a region "columns" pixels to the left without drawing them again. The rightmost
+ *        "columns" columns of the region keep their previous contents and must be drawn by the caller.
+ *
+ * @param[in] start_x X coordinate of the top left corner of the region.
+ * @param[in] start_y Y coordinate of the top left corner of the region.
+ * @param[in] end_x X coordinate of the bottom right corner of the region (not included).
+ * @param[in] end_y Y coordinate of the bottom right corner of the region (not included).
+ * @param[in] columns The number of columns moved.
+ */
+void Display_driver::scroll_region_left(int start_x, int start_y, int end_x, int end_y, int columns){
 
-  if(i != reset_size){
-    SPI_Master::send_spi_msg(msg, default_rx, 0, i % msg_size, 0, speed);
-  }
+  frame_buffer.scroll_left(start_x, start_y, end_x, end_y, columns);
 }
 
 
@@ -116,12 +213,12 @@ void Display_driver::reset_region(int start_x, int start_y, int end_x, int end_y
  * @param[in] background_color color of the background color of the box where the text will be located.
  * @param[in] font font of the text.
  */
-void Display_driver::write_string(int start_x, int start_y, char str[], uint8_t color[], uint8_t background_color[], GFXfont font){
+void Display_driver::write_string(int start_x, int start_y, char str[], uint8_t color[], uint8_t background_color[], const Font &font){
 
-  int y_offset, width;
-  std::vector<uint16_t> string_bytes = prepare_string(str, color, background_color, font, &y_offset, &width);
+  uint16_t background16 = background_color[0] | (background_color[1] << 8);
+  TextRasterizer text(str, font, color[0] | (color[1] << 8), background16);
 
-  draw_icon(start_x, start_y + y_offset, width, string_bytes.data(), string_bytes.size());
+  draw_text_columns(start_x, start_y + text.get_y_offset(), 0, text.get_width(), 0, text, background16);
 }
 
 
@@ -135,12 +232,13 @@ void Display_driver::write_string(int start_x, int start_y, char str[], uint8_t
  * @param[in] background_color color of the background color of the box where the text will be located.
  * @param[in] font font of the text.
  */
-void Display_driver::write_string_centered(int start_y, char str[], uint8_t color[], uint8_t background_color[], GFXfont font){
+void Display_driver::write_string_centered(int start_y, char str[], uint8_t color[], uint8_t background_color[], const Font &font){
 
-  int y_offset, width;
-  std::vector<uint16_t> string_bytes = prepare_string(str, color, background_color, font, &y_offset, &width);
+  uint16_t background16 = background_color[0] | (background_color[1] << 8);
+  TextRasterizer text(str, font, color[0] | (color[1] << 8), background16);
 
-  draw_icon(120 - width/2, start_y + y_offset, width, string_bytes.data(), string_bytes.size());
+  draw_text_columns(120 - text.get_width()/2, start_y + text.get_y_offset(), 0, text.get_width(), 0, text,
+      background16);
 }
 
 
@@ -159,31 +257,13 @@ void Display_driver::write_string_centered(int start_y, char str[], uint8_t colo
  * @param[in] font font of the text.
  */
 void Display_driver::write_string_with_min_width(int start_x, int start_y, int min_width, char str[], uint8_t color[],
-    uint8_t background_color[], GFXfont font){
+    uint8_t background_color[], const Font &font){
 
-  int y_offset, icon_width, total_padding = 0;
-  std::vector<uint16_t> string_bytes = prepare_string(str, color, background_color, font, &y_offset, &icon_width);
-
-  if(min_width > icon_width){
-    total_padding = min_width - icon_width;
-  }
-
-  int height = string_bytes.size()/icon_width;
-  int real_width = icon_width + total_padding;
-  uint16_t result[real_width*height];
-
-  for(int i = 0; i < height; i++){
-    std::copy(
-        string_bytes.begin() + icon_width*i,
-        string_bytes.begin() + icon_width*(i + 1),
-        result + real_width*i);
-    std::fill(
-        result + real_width*i + icon_width,
-        result + real_width*i + icon_width + total_padding,
-        background_color[0] | (background_color[1] << 8));
-  }
-  draw_icon(start_x, start_y + y_offset, real_width, result, real_width * height);
+  uint16_t background16 = background_color[0] | (background_color[1] << 8);
+  TextRasterizer text(str, font, color[0] | (color[1] << 8), background16);
+  int box_width = std::max(min_width, text.get_width());
 
+  draw_text_columns(start_x, start_y + text.get_y_offset(), 0, box_width, 0, text, background16);
 }
 
 
@@ -201,38 +281,46 @@ void Display_driver::write_string_with_min_width(int start_x, int start_y, int m
  * @param[in] font font of the text.
  */
 void Display_driver::write_string_centered_with_min_width(int start_y, int min_width, char str[], uint8_t color[],
-    uint8_t background_color[], GFXfont font){
+    uint8_t background_color[], const Font &font){
 
-  int y_offset, icon_width, total_padding = 0, left_padding, right_padding;
-  std::vector<uint16_t> string_bytes = prepare_string(str, color, background_color, font, &y_offset, &icon_width);
+  uint16_t background16 = background_color[0] | (background_color[1] << 8);
+  TextRasterizer text(str, font, color[0] | (color[1] << 8), background16);
+  int box_width = std::max(min_width, text.get_width());
 
-  if(min_width > icon_width){
-    total_padding = min_width - icon_width;
-  }
-  left_padding = total_padding/2;
-  right_padding = total_padding - int(total_padding/2);
-
-  int height = string_bytes.size()/icon_width;
-  int real_width = icon_width + total_padding;
-  uint16_t result[real_width*height];
-
-  for(int i = 0; i < height; i++){
-    std::fill(
-        result + real_width*i,
-        result + real_width*i + left_padding,
-        background_color[0] | (background_color[1] << 8)
-        );
-    std::copy(
-        string_bytes.begin() + icon_width*i,
-        string_bytes.begin() + icon_width*(i + 1),
-        result + real_width*i + left_padding);
-    std::fill(
-        result + real_width*i + left_padding + icon_width,
-        result + real_width*i + left_padding + icon_width + right_padding,
-        background_color[0] | (background_color[1] << 8));
-  }
-  draw_icon(120 - real_width/2, start_y + y_offset, real_width, result, real_width * height);
+  draw_text_columns(120 - box_width/2, start_y + text.get_y_offset(), 0, box_width,
+      (box_width - text.get_width())/2, text, background16);
+}
+
+
+/**
+ * @brief Writes only the columns [first_column, end_column) of the bounding box that write_string_with_min_width
+ *        (or write_string_centered_with_min_width if "centered" is true) would write. The rest of the bounding
+ *        box is left untouched.
+ *
+ * @param[in] start_x X coordinate of the start of the line where the text will be written. Ignored if "centered"
+ *                    is true.
+ * @param[in] start_y Y coordinate of the start of the line where the text will be written. Letters like "p"
+ *                    or "y" will trespass this line and write its bottom part below it.
+ * @param[in] min_width Minimum width of the bounding box where the text will be located.
+ * @param[in] centered True if the bounding box is centered in the X-axis.
+ * @param[in] first_column First column of the bounding box to write.
+ * @param[in] end_column Column of the bounding box after the last one to write.
+ * @param[in] str string to write.
+ * @param[in] color color of the text to write.
+ * @param[in] background_color color of the background color of the box where the text will be located.
+ * @param[in] font font of the text.
+ */
+void Display_driver::write_string_columns(int start_x, int start_y, int min_width, bool centered, int first_column,
+    int end_column, char str[], uint8_t color[], uint8_t background_color[], const Font &font){
+
+  uint16_t background16 = background_color[0] | (background_color[1] << 8);
+  TextRasterizer text(str, font, color[0] | (color[1] << 8), background16);
+  int box_width = std::max(min_width, text.get_width());
+  int text_x = centered ? (box_width - text.get_width())/2 : 0;
+  int box_x = centered ? 120 - box_width/2 : start_x;
 
+  draw_text_columns(box_x, start_y + text.get_y_offset(), std::max(first_column, 0), std::min(end_column, box_width),
+      text_x, text, background16);
 }
 
 
@@ -240,7 +328,8 @@ void Display_driver::write_string_centered_with_min_width(int start_y, int min_w
  * @brief Writes a text string in the Display inside a bounding box with a supplied fixed width (panning_width).
  *        If the text is greater than this fixed width, the text will pan with a movement of "panning_step".
  *        This function do this process synchronously so will block the calling thread. To exit from this
- *        function prematurely the exit function supplied can be used.
+ *        function prematurely the exit function supplied can be used. It is checked while waiting between
+ *        panning steps, so the function returns a few milliseconds after it becomes true.
  *
  * @param[in] start_x X coordinate of the start of the line where the text will be written. Letters like "p"
  *                    or "y" will trespass this line and write its bottom part below it.
@@ -252,17 +341,19 @@ void Display_driver::write_string_centered_with_min_width(int start_y, int min_w
  * @param[in] color color of the text to write.
  * @param[in] background_color color of the background color of the box where the text will be located.
  * @param[in] font font of the text.
- * @param[in] exit An inline function that will be called every panning cycle. If it returns true, the panning
- *            process will finish.
+ * @param[in] exit An inline function that will be called periodically while panning. If it returns true, the
+ *            panning process will finish.
  */
 void Display_driver::write_panning_string(int start_x, int start_y, int panning_width, int panning_step,
-    char str[], uint8_t color[], uint8_t background_color[], GFXfont font, std::function<bool ()> exit){
+    char str[], uint8_t color[], uint8_t background_color[], const Font &font, std::function<bool ()> exit){
 
-  int y_offset, width;
-  std::vector<uint16_t> string_bytes = prepare_string(str, color, background_color, font, &y_offset, &width);
+  uint16_t background16 = background_color[0] | (background_color[1] << 8);
+  TextRasterizer text(str, font, color[0] | (color[1] << 8), background16);
+  int box_y = start_y + text.get_y_offset();
 
-  draw_panning_icon(start_x, start_y + y_offset, width, panning_width, string_bytes.data(), string_bytes.size(),
-                    panning_step, exit);
+  pan(text.get_width() - panning_width, panning_step, exit, [&](int e){
+    draw_text_columns(start_x, box_y, 0, panning_width, -e, text, background16);
+  });
 }
 
 
@@ -281,73 +372,31 @@ void Display_driver::write_panning_string(int start_x, int start_y, int panning_
  * @param[in] font font of the text.
  */
 void Display_driver::write_string_truncated(int start_x, int start_y, int truncated_width, char str[],
-    uint8_t color[], uint8_t background_color[], GFXfont font){
+    uint8_t color[], uint8_t background_color[], const Font &font){
 
-  int y_offset, icon_width;
-  std::vector<uint16_t> string_bytes = prepare_string(str, color, background_color, font, &y_offset, &icon_width);
-
-  int real_width, total_padding;
-  if(icon_width < truncated_width){
-    real_width = icon_width;
-    total_padding = truncated_width - icon_width;
-  }
-  else{
-    real_width = truncated_width;
-    total_padding = 0;
-  }
+  uint16_t background16 = background_color[0] | (background_color[1] << 8);
+  TextRasterizer text(str, font, color[0] | (color[1] << 8), background16);
 
-  int height = string_bytes.size()/icon_width;
-  uint16_t result[truncated_width*height];
-
-  for(int i = 0; i < height; i++){
-    std::copy(
-        string_bytes.begin() + i*icon_width,
-        string_bytes.begin() + i*icon_width + real_width,
-        result + truncated_width*i);
-    std::fill(
-            result + truncated_width*i + icon_width,
-            result + truncated_width*i + icon_width + total_padding,
-            background_color[0] | (background_color[1] << 8));
-  }
-  draw_icon(start_x, start_y + y_offset, truncated_width, result, truncated_width * height);
+  draw_text_columns(start_x, start_y + text.get_y_offset(), 0, truncated_width, 0, text, background16);
 }
 
 
 /**
- * @brief Draws a given icon to the display overriding the color of the bitmap
+ * @brief Draws a given 1 bit per pixel icon to the display with the supplied colors
  *
  * @param[in] start_x X coordinate of the top left corner of the bounding box containing the icon
  * @param[in] start_y Y coordinate of the top left corner of the bounding box containing the icon
- * @param[in] byte_map bytes of the icon with format 565 of the icon to write
- * @param[in] size size of the bitmap
- * @param[in] color color of the icon
+ * @param[in] width width of the icon in pixels
+ * @param[in] bit_map bits of the icon. Rows are padded to a whole byte and the MSB is the leftmost pixel
+ * @param[in] size size of the bitmap in bytes
+ * @param[in] color color of the set bits
+ * @param[in] background_color color of the cleared bits
  */
-void Display_driver::draw_icon_col(int start_x, int start_y, int width, uint16_t bit_map[],int size, uint8_t color[], uint8_t background_color[]){
-
-	prep_write(start_x, start_y, start_x + width - 1, start_y + size/width - 1);
-
-	int msg_size = 32, e = 0;
-	uint8_t msg[msg_size];
-
-	for(long i = 0; i < size; i++){
-		if(!bit_map[i]){
-		      msg[e++] = background_color[0];
-		      msg[e++] = background_color[1];
-		}else{
-		      msg[e++] = color[0];
-		      msg[e++] = color[1];
-		}
-
-	    if(e == msg_size){
-	      e = 0;
-	      SPI_Master::send_spi_msg(msg, default_rx, 0, sizeof(msg), 0, speed);
-	    }
-	}
-
-	if(e != 0){
-		SPI_Master::send_spi_msg(msg, default_rx, 0, e, 0, speed);
-	}
+void Display_driver::draw_icon_col(int start_x, int start_y, int width, const uint8_t bit_map[], int size,
+    uint8_t color[], uint8_t background_color[]){
 
+  frame_buffer.blit_mono(start_x, start_y, width, bit_map, size,
+      color[0] | (color[1] << 8), background_color[0] | (background_color[1] << 8));
 }
 
 
@@ -361,25 +410,7 @@ void Display_driver::draw_icon_col(int start_x, int start_y, int width, uint16_t
  */
 void Display_driver::draw_icon(int start_x, int start_y, int width, uint16_t bit_map[], int size){
 
-  prep_write(start_x, start_y, start_x + width - 1, start_y + size/width - 1);
-
-	int msg_size = 32, e = 0;
-	uint8_t msg[msg_size];
-
-	for(long i = 0; i < size; i++){
-		msg[e++] = bit_map[i] & 255;
-		msg[e++] = bit_map[i] >> 8;
-
-		if(e == msg_size){
-			e = 0;
-			SPI_Master::send_spi_msg(msg, default_rx, 0, sizeof(msg), 0, speed);
-		}
-	}
-
-	if(e != 0){
-		SPI_Master::send_spi_msg(msg, default_rx, 0, e, 0, speed);
-	}
-
+  frame_buffer.blit(start_x, start_y, width, bit_map, size);
 }
 
 
@@ -387,7 +418,8 @@ void Display_driver::draw_icon(int start_x, int start_y, int width, uint16_t bit
  * @brief Draws the given icon in the Display inside a bounding box with a supplied fixed width (panning_width).
  *        If the icon's width is greater than this fixed width, the icon will pan with a movement of "panning_step".
  *        This function do this process synchronously so will block the calling thread. To exit from this
- *        function prematurely the exit function supplied can be used.
+ *        function prematurely the exit function supplied can be used. It is checked while waiting between
+ *        panning steps, so the function returns a few milliseconds after it becomes true.
  *
  * @param[in] start_x X coordinate of the start of the line where the text will be written. Letters like "p"
  *                    or "y" will trespass this line and write its bottom part below it.
@@ -398,27 +430,105 @@ void Display_driver::draw_icon(int start_x, int start_y, int width, uint16_t bit
  * @param[in] byte_map bytes of the icon with format 565 of the icon to write
  * @param[in] size size of the bitmap
  * @param[in] panning_step The number of pixels that the icon will be moved in every panning cycle.
- * @param[in] exit An inline function that will be called every panning cycle. If it returns true, the panning
- *            process will finish.
+ * @param[in] exit An inline function that will be called periodically while panning. If it returns true, the
+ *            panning process will finish.
  */
 void Display_driver::draw_panning_icon(int start_x, int start_y, int icon_width, int panning_width,
                                        uint16_t bit_map[], int size, int panning_step, std::function<bool ()> exit){
 
-  int panning_lines = icon_width - panning_width, height = size/icon_width;
-  uint16_t result[panning_width*height];
-  panning_step = panning_lines/(int(panning_lines/panning_step)); //Chose the near-lower-divisible panning step
+  int height = size/icon_width;
 
-  for(int e = 0; e < panning_lines; e += panning_step){
-    for(int i = 0; i < height; i++){
-      std::copy(
-          bit_map + i*icon_width + e,
-          bit_map + i*icon_width + e + panning_width,
-          result + panning_width*i);
-      if(exit())
-        return;
-    }
-    draw_icon(start_x, start_y, panning_width, result, panning_width * height);
-  }
+  pan(icon_width - panning_width, panning_step, exit, [&](int e){
+    frame_buffer.render_rows(start_x, start_y, start_x + panning_width, start_y + height,
+        [&](int row, int first, int end, uint16_t pixels[]){
+      std::copy(bit_map + row*icon_width + e + first, bit_map + row*icon_width + e + end, pixels);
+    });
+  });
+}
+
+/**
+ * @brief Obtain the arena where the temporary buffers of the draw functions are allocated. It must be reset
+ *        once the frame has been drawn and flushed.
+ *
+ * @return The arena.
+ */
+FrameArena &Display_driver::get_frame_arena(){
+
+  return frame_arena;
+}
+
+
+/**
+ * @brief Copies everything drawn in the whole Display as a 1 bit per pixel bitmap, so it can be drawn again
+ *        later with load_screen. It only works if the Display only has two colors.
+ *
+ * @param[out] screen Where the bits of the Display are copied. Left empty if it fails.
+ * @param[in] color Color of the set bits.
+ * @param[in] background_color Color of the cleared bits.
+ * @return True if the Display was copied, false if it has other colors.
+ */
+bool Display_driver::save_screen(std::vector<uint8_t> *screen, uint8_t color[], uint8_t background_color[]){
+
+  return frame_buffer.snapshot_mono(screen, color[0] | (color[1] << 8),
+      background_color[0] | (background_color[1] << 8));
+}
+
+
+/**
+ * @brief Draws a whole Display previously copied with save_screen. As any other draw function, only
+ *        the regions that differ from what the Display is showing are sent in the next flush.
+ *
+ * @param[in] screen The bits of the Display.
+ * @param[in] color Color of the set bits.
+ * @param[in] background_color Color of the cleared bits.
+ */
+void Display_driver::load_screen(const std::vector<uint8_t> &screen, uint8_t color[], uint8_t background_color[]){
+
+  frame_buffer.blit_mono(0, 0, display_width, screen.data(), screen.size(), color[0] | (color[1] << 8),
+      background_color[0] | (background_color[1] << 8));
+}
+
+
+/**
+ * @brief Sends to the display all the regions drawn since the previous flush that have really changed.
+ *        The draw functions only render into the frame buffer, so this function must be called once
+ *        the whole frame has been drawn. The regions are sent by a writer thread, so this function only
+ *        waits for the previous flush to be sent and the next frame can be drawn while this one is sent.
+ */
+void Display_driver::flush(){
+
+  std::unique_lock<std::mutex> lock(writer_mutex);
+  writer_cond.wait(lock, [this](){ return !writer_busy; });
+
+  //The writer thread sends the regions from the panel contents of the frame buffer, that are only
+  //modified here, while the draw functions keep working on the rendered contents
+  frame_buffer.take_dirty_regions(&writer_regions);
+  if(writer_regions.empty())
+    return;
+
+  writer_busy = true;
+  writer_cond.notify_all();
+}
+
+/**
+ * @brief Waits until the display has received everything flushed.
+ */
+void Display_driver::wait_flush(){
+
+  std::unique_lock<std::mutex> lock(writer_mutex);
+  writer_cond.wait(lock, [this](){ return !writer_busy; });
+}
+
+/**
+ * @brief Obtain the average time that the last flushes have taken to reach the display. Can be called from
+ *        any thread.
+ *
+ * @return The time in microseconds.
+ */
+int Display_driver::get_flush_time_us(){
+
+  std::lock_guard<std::mutex> lock(writer_mutex);
+  return flush_time_us;
 }
 
 /**
@@ -426,98 +536,223 @@ void Display_driver::draw_panning_icon(int start_x, int start_y, int icon_width,
  */
 void Display_driver::uninit(){
 
-	SPI_Master::spi_end();
+  {
+    std::lock_guard<std::mutex> lock(writer_mutex);
+    writer_exit = true;
+    writer_cond.notify_all();
+  }
+  if(writer_thread.joinable())
+    writer_thread.join();
+  writer_exit = false;
+
+	transport->end();
 
 }
 
 
+/**
+ * @brief Class destructor. Calls uninit if the display is still initialized.
+ */
+Display_driver::~Display_driver(){
+  if(writer_thread.joinable())
+    uninit();
+}
+
+
 /* Private functions ---------------------------------------------------------*/
 /**
  * @brief Prepare the Display to write an icon or a string. This function send the pertinent
- *        commands to do that.
+ *        commands to do that. The column and row addresses are only sent when they differ from
+ *        the last ones programmed, but the memory write command is always sent because it moves
+ *        the display write pointer back to the start of the window.
  *
  * @param[in] start_x X coordinate of the top left corner of the bounding box containing the icon
  * @param[in] start_y Y coordinate of the top left corner of the bounding box containing the icon
  * @param[in] end_x X coordinate of the bottom right corner of the bounding box containing the icon
  * @param[in] end_y Y coordinate of the bottom fight corner of the bounding box containing the icon
  */
-void prep_write(uint8_t start_x, uint8_t start_y, uint8_t end_x, uint8_t end_y){
-  uint8_t col_data[4] = {0x00, start_x, 0x00, end_x};
-  uint8_t row_data[4] = {0x00, start_y, 0x00, end_y};
+void Display_driver::prep_write(int start_x, int start_y, int end_x, int end_y){
+
+  if(start_x != window_start_x || end_x != window_end_x){
+    int first = start_x + rotation_configs[rotation].x_offset, last = end_x + rotation_configs[rotation].x_offset;
+    uint8_t col_data[4] = {uint8_t(first >> 8), uint8_t(first), uint8_t(last >> 8), uint8_t(last)};
+    send_command(col_set_addr, col_data, sizeof(col_data));
+    window_start_x = start_x;
+    window_end_x = end_x;
+  }
 
-  SPI_Master::send_spi_msg(col_set_addr, default_rx, 1, sizeof(col_set_addr), 1000, speed);
-  SPI_Master::send_spi_msg(col_data, default_rx, 0, 4, 0, speed);
-  SPI_Master::send_spi_msg(row_set_addr, default_rx, 1, sizeof(row_set_addr), 1000, speed);
-  SPI_Master::send_spi_msg(row_data, default_rx, 0, 4, 0, speed);
-  SPI_Master::send_spi_msg(mem_data_cmd, default_rx, 1, sizeof(mem_data_cmd), 1000, speed);
+  if(start_y != window_start_y || end_y != window_end_y){
+    int first = start_y + rotation_configs[rotation].y_offset, last = end_y + rotation_configs[rotation].y_offset;
+    uint8_t row_data[4] = {uint8_t(first >> 8), uint8_t(first), uint8_t(last >> 8), uint8_t(last)};
+    send_command(row_set_addr, row_data, sizeof(row_data));
+    window_start_y = start_y;
+    window_end_y = end_y;
+  }
 
+  send_command(mem_data_cmd, NULL, 0);
 }
 
+
 /**
- * @brief Converts the supplied string into a bitmap using the supplied font.
- *
- * @brief Writes a text string in the Display inside a bounding box with a supplied fixed width (truncated_width).
- *        If the text is greater than this fixed width, the text will be truncated.
+ * @brief Writer thread. Sends the regions handed over by flush until uninit is called. The regions
+ *        flushed before uninit are always sent.
+ */
+void Display_driver::writer_thread_fn(){
+  std::unique_lock<std::mutex> lock(writer_mutex);
+
+  while(true){
+    writer_cond.wait(lock, [this](){ return writer_busy || writer_exit; });
+    if(!writer_busy)
+      return;
+
+    lock.unlock();
+    auto start = std::chrono::steady_clock::now();
+    send_regions(writer_regions);
+    int send_time_us = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start).count();
+    lock.lock();
+
+    flush_time_us = (3 * flush_time_us + send_time_us) / 4;
+    writer_busy = false;
+    writer_cond.notify_all();
+  }
+}
+
+
+/**
+ * @brief Sends some regions of the panel contents of the frame buffer to the display. The regions that
+ *        only have one color are sent as a fill.
  *
- * @param[in] str The string to write.
- * @param[in] color Color of the text to write.
- * @param[in] background_color Background color of the box where the text will be located.
- * @param[in] font font of the text.
- * @param[out] text_y_offset pixels from the line where the imaginary line is written and the uppermost
- *                           border of the bounding box.
- * @param[out] width Width of the resulting icon.
+ * @param[in] regions The regions.
  */
-std::vector<uint16_t> prepare_string(char str[], uint8_t color[], uint8_t background_color[], GFXfont font,
-    int *text_y_offset, int *width){
+void Display_driver::send_regions(const std::vector<FB_RECT> &regions){
 
-  int height, largest_last_row = 0;
+  for(FB_RECT region : regions){
+    int region_width = region.end_x - region.start_x;
+    uint16_t first_pixel = frame_buffer.panel_row(region.start_y)[region.start_x];
+    bool solid = true;
 
-  *text_y_offset = 0;
-  *width = 0;
+    for(int y = region.start_y; y < region.end_y && solid; y++){
+      const uint16_t *pixels = frame_buffer.panel_row(y) + region.start_x;
+      solid = std::all_of(pixels, pixels + region_width, [first_pixel](uint16_t p){ return p == first_pixel; });
+    }
 
-  for(size_t i=0; i < strlen(str); i++){
-    GFXglyph glyph = font.glyph[str[i] - font.first];
+    prep_write(region.start_x, region.start_y, region.end_x - 1, region.end_y - 1);
 
-    if(glyph.yOffset < (*text_y_offset))
-      *text_y_offset = glyph.yOffset;
+    if(solid){
+      transport->send_fill((const uint8_t *)&first_pixel, sizeof(first_pixel),
+          long(region_width) * (region.end_y - region.start_y), 0);
+      continue;
+    }
 
-    int last_row = glyph.yOffset + glyph.height;
-    if(largest_last_row < last_row)
-      largest_last_row = last_row;
+    //The rows are sent straight from the frame buffer, which is already in the panel byte order. Rows that
+    //follow each other in memory (regions as wide as the display) are merged into a single segment.
+    segments.clear();
+    for(int y = region.start_y; y < region.end_y; y++){
+      const uint8_t *data = (const uint8_t *)(frame_buffer.panel_row(y) + region.start_x);
+      int size = region_width * sizeof(uint16_t);
+
+      if(!segments.empty() && segments.back().data + segments.back().size == data)
+        segments.back().size += size;
+      else
+        segments.push_back({data, size});
+    }
+    transport->send_segments(segments.data(), segments.size(), 0);
+  }
+}
+
+
+/**
+ * @brief Sends a one byte command followed by its parameters without any delay. The DC pin that
+ *        separates commands from data can't change in the middle of an SPI message, so the command and
+ *        its parameters are sent with one transmit-only message each.
+ *
+ * @param[in] cmd The command byte.
+ * @param[in] data The command parameters. Can be NULL if "data_size" is 0.
+ * @param[in] data_size The number of bytes of the parameters.
+ */
+void Display_driver::send_command(uint8_t cmd[], uint8_t data[], int data_size){
+  SPI_SEGMENT cmd_segment = {cmd, 1};
+  transport->send_segments(&cmd_segment, 1, 1);
 
-    *width += glyph.xAdvance;
+  if(data_size > 0){
+    SPI_SEGMENT data_segment = {data, data_size};
+    transport->send_segments(&data_segment, 1, 0);
   }
-  height = largest_last_row - (*text_y_offset);
+}
 
-  std::vector<uint16_t> string_bytes(height * (*width), background_color[0] | (background_color[1] << 8));
 
-  int string_byte_index = 0;
-  uint16_t color16 = (((uint16_t)color[1]) << 8) | color[0];
+/**
+ * @brief Draws some columns of a bounding box that contains a text. The text is rendered row by row directly
+ *        into the frame buffer and the columns of the box not covered by the text take the background color.
+ *
+ * @param[in] box_x X coordinate of the left column of the box.
+ * @param[in] box_y Y coordinate of the uppermost row of the box. The box is as high as the text.
+ * @param[in] first_column First column of the box to draw.
+ * @param[in] end_column Column of the box after the last one to draw.
+ * @param[in] text_x Column of the box where the text starts. It is negative if the text starts before the box.
+ * @param[in] text The text.
+ * @param[in] background Background color of the box.
+ */
+void Display_driver::draw_text_columns(int box_x, int box_y, int first_column, int end_column, int text_x,
+    const TextRasterizer &text, uint16_t background){
+
+  int text_first = std::max(first_column, text_x);
+  int text_end = std::min(end_column, text_x + text.get_width());
+
+  frame_buffer.render_rows(box_x + first_column, box_y, box_x + end_column, box_y + text.get_height(),
+      [&](int row, int first, int end, uint16_t pixels[]){
+    //Columns of the box
+    first += first_column;
+    end += first_column;
+
+    int first_text = std::max(first, text_first), end_text = std::min(end, text_end);
+    if(first_text >= end_text){
+      std::fill(pixels, pixels + (end - first), background);
+      return;
+    }
 
-  for(int i=0; i < height; i++){
-    for(size_t e=0; e < strlen(str); e++){
+    std::fill(pixels, pixels + (first_text - first), background);
+    text.render_row(row, first_text - text_x, end_text - text_x, pixels + (first_text - first));
+    std::fill(pixels + (end_text - first), pixels + (end - first), background);
+  });
+}
+
+
+/**
+ * @brief Pans something wider than the space where it is drawn. Every "panning_period_us" microseconds, it is
+ *        drawn moved "panning_step" pixels to the left and flushed, until its right edge is reached or the exit
+ *        function returns true. It is checked while waiting between panning steps.
+ *
+ * @param[in] panning_lines The number of pixels that don't fit in the space. Nothing is drawn if it is 0 or less.
+ * @param[in] panning_step The number of pixels moved in every panning cycle. It is reduced so the last step
+ *                         reaches the right edge exactly.
+ * @param[in] exit The exit function.
+ * @param[in] draw_step Function that draws the step, called with the number of pixels moved.
+ */
+void Display_driver::pan(int panning_lines, int panning_step, std::function<bool ()> exit,
+    std::function<void (int)> draw_step){
 
-      GFXglyph glyph = font.glyph[str[e] - font.first];
+  if(panning_lines <= 0)
+    return;
 
-      if((*text_y_offset) + i >= glyph.yOffset && glyph.height + glyph.yOffset - (*text_y_offset) > i){
-        int btmp_offset_bits = ((*text_y_offset) + i - glyph.yOffset) * glyph.width;
-        int btmp_offset_bytes = btmp_offset_bits / 8;
-        int btmp_offset_remainder = btmp_offset_bits % 8;
+  panning_step = std::min(panning_step, panning_lines);
+  panning_step = panning_lines/(int(panning_lines/panning_step)); //Chose the near-lower-divisible panning step
 
-        char bitmap_byte = font.bitmap[glyph.bitmapOffset + btmp_offset_bytes];
-        int a = btmp_offset_remainder;
+  for(int e = 0; e < panning_lines; e += panning_step){
+    auto step_end = std::chrono::steady_clock::now() + std::chrono::microseconds(panning_period_us);
 
-        do{
-          if(bitmap_byte & (1 << (7 - a%8)))
-            string_bytes[string_byte_index + glyph.xOffset + a - btmp_offset_remainder] = color16;
+    if(exit())
+      return;
 
-          if((++a) % 8 == 0)
-            bitmap_byte = font.bitmap[glyph.bitmapOffset + (++btmp_offset_bytes)];
-        }while(a < glyph.width + btmp_offset_remainder);
-      }
+    draw_step(e);
+    flush();
 
-      string_byte_index += glyph.xAdvance;
+    //Wait for the next step without ignoring the exit condition
+    while(std::chrono::steady_clock::now() < step_end){
+      if(exit())
+        return;
+      usleep(panning_poll_us);
     }
   }
-  return string_bytes;
 }
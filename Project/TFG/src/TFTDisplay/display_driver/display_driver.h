@@ -15,193 +15,365 @@
 #define __DISPLAY_DRIVER_H__
 
 /* Includes ------------------------------------------------------------------*/
+#include <condition_variable>
 #include <functional>
-#include "../spi_master/spi_master.h"
-#include "../fonts/gfxfont.h"
-#include "../fonts/FreeSansBold12pt7b.h"
-#include "../fonts/FreeSansBold18pt7b.h"
-#include "../fonts/FreeSansBold24pt7b.h"
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-/* Exported variables --------------------------------------------------------*/
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "../display_transport/display_transport.h"
+#include "../frame_arena/frame_arena.h"
+#include "../frame_buffer/frame_buffer.h"
+#include "../fonts/font.h"
+#include "../fonts/font_bitmaps.h"
+
 /* Exported types ------------------------------------------------------------*/
-/* Exported constants --------------------------------------------------------*/
-/* Exported macro ------------------------------------------------------------*/
-/* Exported Functions --------------------------------------------------------*/
 
-#ifdef __cplusplus
-namespace Display_driver{
-#endif
 /**
- * @brief Initializes the display with a black background.
+ * Orientation of the contents of the panel, as a clockwise rotation from the default orientation.
  */
-void init_display();
+typedef enum{
+  ROTATION_0 = 0,
+  ROTATION_90,
+  ROTATION_180,
+  ROTATION_270
+}DISPLAY_ROTATION;
 
-/**
- * @brief Reset a region with an uniform color.
- *
- * @param[in] start_x X coordinate of the top left corner of the bounding box containing the icon
- * @param[in] start_y Y coordinate of the top left corner of the bounding box containing the icon
- * @param[in] end_x X coordinate of the bottom right corner of the bounding box containing the icon
- * @param[in] end_y Y coordinate of the bottom fight corner of the bounding box containing the icon
- * @param[in] reset_color Color of the region.
- */
-void reset_region(int start_x, int start_y, int end_x, int end_y, uint8_t reset_color[]);
+/* Exported constants --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported Classes ----------------------------------------------------------*/
 
-/**
- * @brief Writes a text string in the Display
- *
- * @param[in] start_x X coordinate of the start of the line where the text will be written. Letters like "p"
- *                    or "y" will trespass this line and write its bottom part below it.
- * @param[in] start_y Y coordinate of the start of the line where the text will be written. Letters like "p"
- *                    or "y" will trespass this line and write its bottom part below it.
- * @param[in] str string to write.
- * @param[in] color color of the text to write.
- * @param[in] background_color color of the background color of the box where the text will be located.
- * @param[in] font font of the text.
- */
-void write_string(int start_x, int start_y, char str[], uint8_t color[], uint8_t background_color[], GFXfont font);
+class TextRasterizer;
 
 /**
- * @brief Writes a text string in the Display centered in the X-axis
- *
- * @param[in] start_y Y coordinate of the start of the line where the text will be written. Letters like "p"
- *                    or "y" will trespass this line and write its bottom part below it.
- * @param[in] str string to write.
- * @param[in] color color of the text to write.
- * @param[in] background_color color of the background color of the box where the text will be located.
- * @param[in] font font of the text.
+ * Driver of one ST7789 panel. Every instance has its own transport, frame buffer, frame arena, window
+ * cache and writer thread, so several panels can be drawn and refreshed at the same time from different
+ * threads. The draw functions of one instance must be called from a single thread.
  */
-void write_string_centered(int start_y, char str[], uint8_t color[], uint8_t background_color[], GFXfont font);
+class Display_driver{
+  static constexpr int display_width = 240;
+  static constexpr int display_height = 240;
 
-/**
- * @brief Writes a text string in the Display inside a bounding box with a supplied minimum width. If the text
- *        is greater than this minimum width, the bounding box will resize to the demanded width.
- *
- * @param[in] start_x X coordinate of the start of the line where the text will be written. Letters like "p"
- *                    or "y" will trespass this line and write its bottom part below it.
- * @param[in] start_y Y coordinate of the start of the line where the text will be written. Letters like "p"
- *                    or "y" will trespass this line and write its bottom part below it.
- * @param[in] min_width Minimum width of the bounding box where the text will be located.
- * @param[in] str string to write.
- * @param[in] color color of the text to write.
- * @param[in] background_color color of the background color of the box where the text will be located.
- * @param[in] font font of the text.
- */
-void write_string_with_min_width(int start_x, int start_y, int min_width, char str[], uint8_t color[],
-    uint8_t background_color[], GFXfont font);
+  DisplayTransport *transport;            //Destination of the command stream
+  DISPLAY_ROTATION rotation;
+  int window_start_x;                     //Last column/row window programmed in the display.
+  int window_start_y;                     //-1 means unknown.
+  int window_end_x;
+  int window_end_y;
+  FrameBuffer frame_buffer;
+  FrameArena frame_arena;
+  std::vector<SPI_SEGMENT> segments;      //Rows of the region that the writer thread is sending
 
-/**
- * @brief Writes a text string in the Display centered in the X-axis and inside a bounding box with a supplied
- *        minimum width. If the text is greater than this minimum width, the bounding box will resize to the
- *        demanded width.
- *
- * @param[in] start_y Y coordinate of the start of the line where the text will be written. Letters like "p"
- *                    or "y" will trespass this line and write its bottom part below it.
- * @param[in] min_width Minimum width of the bounding box where the text will be located.
- * @param[in] str string to write.
- * @param[in] color color of the text to write.
- * @param[in] background_color color of the background color of the box where the text will be located.
- * @param[in] font font of the text.
- */
-void write_string_centered_with_min_width(int start_y, int min_width, char str[], uint8_t color[],
-    uint8_t background_color[], GFXfont font);
+  std::thread writer_thread;              //Sends a flushed frame while the next one is drawn
+  std::mutex writer_mutex;
+  std::condition_variable writer_cond;
+  std::vector<FB_RECT> writer_regions;    //Regions of the frame that the writer thread is sending
+  bool writer_busy;
+  bool writer_exit;
+  int flush_time_us;                      //Average time that the writer thread takes to send a frame
 
-/**
- * @brief Writes a text string in the Display inside a bounding box with a supplied fixed width (panning_width).
- *        If the text is greater than this fixed width, the text will pan with a movement of "panning_step".
- *        This function do this process synchronously so will block the calling thread. To exit from this
- *        function prematurely the exit function supplied can be used.
- *
- * @param[in] start_x X coordinate of the start of the line where the text will be written. Letters like "p"
- *                    or "y" will trespass this line and write its bottom part below it.
- * @param[in] start_y Y coordinate of the start of the line where the text will be written. Letters like "p"
- *                    or "y" will trespass this line and write its bottom part below it.
- * @param[in] panning_width Fixed width of the bounding box where the text will be located.
- * @param[in] panning_step The number of pixels that the text will be moved in every panning cycle.
- * @param[in] str string to write.
- * @param[in] color color of the text to write.
- * @param[in] background_color color of the background color of the box where the text will be located.
- * @param[in] font font of the text.
- * @param[in] exit An inline function that will be called every panning cycle. If it returns true, the panning
- *                 process will finish.
- */
-void write_panning_string(int start_x, int start_y, int panning_width, int panning_step, char str[], uint8_t color[],
-    uint8_t background_color[], GFXfont font, std::function<bool ()> exit);
+  void prep_write(int start_x, int start_y, int end_x, int end_y);
+  void send_command(uint8_t cmd[], uint8_t data[], int data_size);
+  void writer_thread_fn();
+  void send_regions(const std::vector<FB_RECT> &regions);
+  void draw_text_columns(int box_x, int box_y, int first_column, int end_column, int text_x,
+      const TextRasterizer &text, uint16_t background);
+  void pan(int panning_lines, int panning_step, std::function<bool ()> exit, std::function<void (int)> draw_step);
+public:
 
-/**
- * @brief Writes a text string in the Display inside a bounding box with a supplied fixed width (truncated_width).
- *        If the text is greater than this fixed width, the text will be truncated.
- *
- * @param[in] start_x X coordinate of the start of the line where the text will be written. Letters like "p"
- *                    or "y" will trespass this line and write its bottom part below it.
- * @param[in] start_y Y coordinate of the start of the line where the text will be written. Letters like "p"
- *                    or "y" will trespass this line and write its bottom part below it.
- * @param[in] truncated_width Fixed width of the bounding box where the text will be located.
- * @param[in] str string to write.
- * @param[in] color color of the text to write.
- * @param[in] background_color color of the background color of the box where the text will be located.
- * @param[in] font font of the text.
- */
-void write_string_truncated(int start_x, int start_y, int truncated_width, char str[], uint8_t color[],
-    uint8_t background_color[], GFXfont font);
+  /**
+   * @brief Class constructor. Nothing is sent to the panel until init_display is called.
+   *
+   * @param[in] transport Where the ST7789 command stream is sent, e.g. a SpidevTransport with the spidev
+   *                      device and the DC pin of the panel. It must remain valid until uninit returns or
+   *                      the driver is destroyed.
+   */
+  Display_driver(DisplayTransport *transport);
 
-/**
- * @brief Draws a given icon to the display overriding the color of the bitmap
- *
- * @param[in] start_x X coordinate of the top left corner of the bounding box containing the icon
- * @param[in] start_y Y coordinate of the top left corner of the bounding box containing the icon
- * @param[in] byte_map bytes of the icon with format 565 of the icon to write
- * @param[in] size size of the bitmap
- * @param[in] color color of the icon
- */
-void draw_icon_col(int start_x, int start_y, int width, uint16_t bit_map[],int size, uint8_t color[],
-    uint8_t background_color[]);
+  /**
+   * @brief Initializes the display with a black background and starts its writer thread.
+   */
+  void init_display();
 
-/**
- * @brief Draws a given icon to the display without overriding the color of the bitmap
- *
- * @param[in] start_x X coordinate of the top left corner of the bounding box containing the icon
- * @param[in] start_y Y coordinate of the top left corner of the bounding box containing the icon
- * @param[in] byte_map bytes of the icon with format 565 of the icon to write
- * @param[in] size size of the bitmap
- */
-void draw_icon(int start_x, int start_y, int width, uint16_t bit_map[], int size);
+  /**
+   * @brief Rotates the contents of the panel. The panel does the rotation while it stores the pixels (MADCTL),
+   *        so it has no cost per pixel; the whole frame is sent again in the next flush with the new orientation.
+   *        The panel is square, so every layout fits in every orientation. If it is called before init_display,
+   *        the rotation is applied when the panel is initialized.
+   *
+   * @param[in] new_rotation The rotation.
+   */
+  void set_rotation(DISPLAY_ROTATION new_rotation);
 
-/**
- * @brief Draws the given icon in the Display inside a bounding box with a supplied fixed width (panning_width).
- *        If the icon's width is greater than this fixed width, the icon will pan with a movement of "panning_step".
- *        This function do this process synchronously so will block the calling thread. To exit from this
- *        function prematurely the exit function supplied can be used.
- *
- * @param[in] start_x X coordinate of the start of the line where the text will be written. Letters like "p"
- *                    or "y" will trespass this line and write its bottom part below it.
- * @param[in] start_y Y coordinate of the start of the line where the text will be written. Letters like "p"
- *                    or "y" will trespass this line and write its bottom part below it.
- * @param[in] icon_width Icon width in pixels.
- * @param[in] panning_width Fixed width of the bounding box where the icon will be located.
- * @param[in] byte_map bytes of the icon with format 565 of the icon to write
- * @param[in] size size of the bitmap
- * @param[in] panning_step The number of pixels that the icon will be moved in every panning cycle.
- * @param[in] exit An inline function that will be called every panning cycle. If it returns true, the panning
- *                 process will finish.
- */
-void draw_panning_icon(int start_x, int start_y, int icon_width, int panning_width, uint16_t bit_map[],
-    int size, int panning_step, std::function<bool ()> exit);
+  /**
+   * @brief Turns the panel off and puts it in sleep mode after the last flush has been sent. The panel keeps
+   *        its memory while sleeping, so nothing has to be sent again when it wakes up.
+   */
+  void sleep_display();
 
-/**
- * @brief Ends SPI communications and release all the related resources.
- */
-void uninit();
+  /**
+   * @brief Wakes the panel up from sleep mode and turns it on. It shows again the last frame it received,
+   *        plus the regions flushed while sleeping.
+   */
+  void wake_display();
+
+  /**
+   * @brief Obtain the rotation of the contents of the panel.
+   *
+   * @return The rotation.
+   */
+  DISPLAY_ROTATION get_rotation();
+
+  /**
+   * @brief Reset a region with an uniform color.
+   *
+   * @param[in] start_x X coordinate of the top left corner of the bounding box containing the icon
+   * @param[in] start_y Y coordinate of the top left corner of the bounding box containing the icon
+   * @param[in] end_x X coordinate of the bottom right corner of the bounding box containing the icon
+   * @param[in] end_y Y coordinate of the bottom fight corner of the bounding box containing the icon
+   * @param[in] reset_color Color of the region.
+   */
+  void reset_region(int start_x, int start_y, int end_x, int end_y, uint8_t reset_color[]);
+
+  /**
+   * @brief Moves the contents of a region "columns" pixels to the left without drawing them again. The rightmost
+   *        "columns" columns of the region keep their previous contents and must be drawn by the caller.
+   *
+   * @param[in] start_x X coordinate of the top left corner of the region.
+   * @param[in] start_y Y coordinate of the top left corner of the region.
+   * @param[in] end_x X coordinate of the bottom right corner of the region (not included).
+   * @param[in] end_y Y coordinate of the bottom right corner of the region (not included).
+   * @param[in] columns The number of columns moved.
+   */
+  void scroll_region_left(int start_x, int start_y, int end_x, int end_y, int columns);
+
+  /**
+   * @brief Writes a text string in the Display
+   *
+   * @param[in] start_x X coordinate of the start of the line where the text will be written. Letters like "p"
+   *                    or "y" will trespass this line and write its bottom part below it.
+   * @param[in] start_y Y coordinate of the start of the line where the text will be written. Letters like "p"
+   *                    or "y" will trespass this line and write its bottom part below it.
+   * @param[in] str string to write.
+   * @param[in] color color of the text to write.
+   * @param[in] background_color color of the background color of the box where the text will be located.
+   * @param[in] font font of the text.
+   */
+  void write_string(int start_x, int start_y, char str[], uint8_t color[], uint8_t background_color[], const Font &font);
+
+  /**
+   * @brief Writes a text string in the Display centered in the X-axis
+   *
+   * @param[in] start_y Y coordinate of the start of the line where the text will be written. Letters like "p"
+   *                    or "y" will trespass this line and write its bottom part below it.
+   * @param[in] str string to write.
+   * @param[in] color color of the text to write.
+   * @param[in] background_color color of the background color of the box where the text will be located.
+   * @param[in] font font of the text.
+   */
+  void write_string_centered(int start_y, char str[], uint8_t color[], uint8_t background_color[], const Font &font);
+
+  /**
+   * @brief Writes a text string in the Display inside a bounding box with a supplied minimum width. If the text
+   *        is greater than this minimum width, the bounding box will resize to the demanded width.
+   *
+   * @param[in] start_x X coordinate of the start of the line where the text will be written. Letters like "p"
+   *                    or "y" will trespass this line and write its bottom part below it.
+   * @param[in] start_y Y coordinate of the start of the line where the text will be written. Letters like "p"
+   *                    or "y" will trespass this line and write its bottom part below it.
+   * @param[in] min_width Minimum width of the bounding box where the text will be located.
+   * @param[in] str string to write.
+   * @param[in] color color of the text to write.
+   * @param[in] background_color color of the background color of the box where the text will be located.
+   * @param[in] font font of the text.
+   */
+  void write_string_with_min_width(int start_x, int start_y, int min_width, char str[], uint8_t color[],
+      uint8_t background_color[], const Font &font);
+
+  /**
+   * @brief Writes a text string in the Display centered in the X-axis and inside a bounding box with a supplied
+   *        minimum width. If the text is greater than this minimum width, the bounding box will resize to the
+   *        demanded width.
+   *
+   * @param[in] start_y Y coordinate of the start of the line where the text will be written. Letters like "p"
+   *                    or "y" will trespass this line and write its bottom part below it.
+   * @param[in] min_width Minimum width of the bounding box where the text will be located.
+   * @param[in] str string to write.
+   * @param[in] color color of the text to write.
+   * @param[in] background_color color of the background color of the box where the text will be located.
+   * @param[in] font font of the text.
+   */
+  void write_string_centered_with_min_width(int start_y, int min_width, char str[], uint8_t color[],
+      uint8_t background_color[], const Font &font);
+
+  /**
+   * @brief Writes only the columns [first_column, end_column) of the bounding box that write_string_with_min_width
+   *        (or write_string_centered_with_min_width if "centered" is true) would write. The rest of the bounding
+   *        box is left untouched.
+   *
+   * @param[in] start_x X coordinate of the start of the line where the text will be written. Ignored if "centered"
+   *                    is true.
+   * @param[in] start_y Y coordinate of the start of the line where the text will be written. Letters like "p"
+   *                    or "y" will trespass this line and write its bottom part below it.
+   * @param[in] min_width Minimum width of the bounding box where the text will be located.
+   * @param[in] centered True if the bounding box is centered in the X-axis.
+   * @param[in] first_column First column of the bounding box to write.
+   * @param[in] end_column Column of the bounding box after the last one to write.
+   * @param[in] str string to write.
+   * @param[in] color color of the text to write.
+   * @param[in] background_color color of the background color of the box where the text will be located.
+   * @param[in] font font of the text.
+   */
+  void write_string_columns(int start_x, int start_y, int min_width, bool centered, int first_column,
+      int end_column, char str[], uint8_t color[], uint8_t background_color[], const Font &font);
+
+  /**
+   * @brief Writes a text string in the Display inside a bounding box with a supplied fixed width (panning_width).
+   *        If the text is greater than this fixed width, the text will pan with a movement of "panning_step".
+   *        This function do this process synchronously so will block the calling thread. To exit from this
+   *        function prematurely the exit function supplied can be used. It is checked while waiting between
+   *        panning steps, so the function returns a few milliseconds after it becomes true.
+   *
+   * @param[in] start_x X coordinate of the start of the line where the text will be written. Letters like "p"
+   *                    or "y" will trespass this line and write its bottom part below it.
+   * @param[in] start_y Y coordinate of the start of the line where the text will be written. Letters like "p"
+   *                    or "y" will trespass this line and write its bottom part below it.
+   * @param[in] panning_width Fixed width of the bounding box where the text will be located.
+   * @param[in] panning_step The number of pixels that the text will be moved in every panning cycle.
+   * @param[in] str string to write.
+   * @param[in] color color of the text to write.
+   * @param[in] background_color color of the background color of the box where the text will be located.
+   * @param[in] font font of the text.
+   * @param[in] exit An inline function that will be called periodically while panning. If it returns true, the
+   *                 panning process will finish.
+   */
+  void write_panning_string(int start_x, int start_y, int panning_width, int panning_step, char str[], uint8_t color[],
+      uint8_t background_color[], const Font &font, std::function<bool ()> exit);
+
+  /**
+   * @brief Writes a text string in the Display inside a bounding box with a supplied fixed width (truncated_width).
+   *        If the text is greater than this fixed width, the text will be truncated.
+   *
+   * @param[in] start_x X coordinate of the start of the line where the text will be written. Letters like "p"
+   *                    or "y" will trespass this line and write its bottom part below it.
+   * @param[in] start_y Y coordinate of the start of the line where the text will be written. Letters like "p"
+   *                    or "y" will trespass this line and write its bottom part below it.
+   * @param[in] truncated_width Fixed width of the bounding box where the text will be located.
+   * @param[in] str string to write.
+   * @param[in] color color of the text to write.
+   * @param[in] background_color color of the background color of the box where the text will be located.
+   * @param[in] font font of the text.
+   */
+  void write_string_truncated(int start_x, int start_y, int truncated_width, char str[], uint8_t color[],
+      uint8_t background_color[], const Font &font);
 
-#ifdef __cplusplus
-}
-#endif
+  /**
+   * @brief Draws a given 1 bit per pixel icon to the display with the supplied colors
+   *
+   * @param[in] start_x X coordinate of the top left corner of the bounding box containing the icon
+   * @param[in] start_y Y coordinate of the top left corner of the bounding box containing the icon
+   * @param[in] width width of the icon in pixels
+   * @param[in] bit_map bits of the icon. Rows are padded to a whole byte and the MSB is the leftmost pixel
+   * @param[in] size size of the bitmap in bytes
+   * @param[in] color color of the set bits
+   * @param[in] background_color color of the cleared bits
+   */
+  void draw_icon_col(int start_x, int start_y, int width, const uint8_t bit_map[], int size, uint8_t color[],
+      uint8_t background_color[]);
 
-#ifdef __cplusplus
-}
-#endif
+  /**
+   * @brief Draws a given icon to the display without overriding the color of the bitmap
+   *
+   * @param[in] start_x X coordinate of the top left corner of the bounding box containing the icon
+   * @param[in] start_y Y coordinate of the top left corner of the bounding box containing the icon
+   * @param[in] byte_map bytes of the icon with format 565 of the icon to write
+   * @param[in] size size of the bitmap
+   */
+  void draw_icon(int start_x, int start_y, int width, uint16_t bit_map[], int size);
+
+  /**
+   * @brief Draws the given icon in the Display inside a bounding box with a supplied fixed width (panning_width).
+   *        If the icon's width is greater than this fixed width, the icon will pan with a movement of "panning_step".
+   *        This function do this process synchronously so will block the calling thread. To exit from this
+   *        function prematurely the exit function supplied can be used. It is checked while waiting between
+   *        panning steps, so the function returns a few milliseconds after it becomes true.
+   *
+   * @param[in] start_x X coordinate of the start of the line where the text will be written. Letters like "p"
+   *                    or "y" will trespass this line and write its bottom part below it.
+   * @param[in] start_y Y coordinate of the start of the line where the text will be written. Letters like "p"
+   *                    or "y" will trespass this line and write its bottom part below it.
+   * @param[in] icon_width Icon width in pixels.
+   * @param[in] panning_width Fixed width of the bounding box where the icon will be located.
+   * @param[in] byte_map bytes of the icon with format 565 of the icon to write
+   * @param[in] size size of the bitmap
+   * @param[in] panning_step The number of pixels that the icon will be moved in every panning cycle.
+   * @param[in] exit An inline function that will be called periodically while panning. If it returns true, the
+   *                 panning process will finish.
+   */
+  void draw_panning_icon(int start_x, int start_y, int icon_width, int panning_width, uint16_t bit_map[],
+      int size, int panning_step, std::function<bool ()> exit);
+
+  /**
+   * @brief Obtain the arena where the temporary buffers of the draw functions are allocated. It must be reset
+   *        once the frame has been drawn and flushed. It can also be used for the buffers that the caller
+   *        needs while drawing a frame.
+   *
+   * @return The arena.
+   */
+  FrameArena &get_frame_arena();
+
+  /**
+   * @brief Copies everything drawn in the whole Display as a 1 bit per pixel bitmap, so it can be drawn again
+   *        later with load_screen. It only works if the Display only has two colors.
+   *
+   * @param[out] screen Where the bits of the Display are copied. Left empty if it fails.
+   * @param[in] color Color of the set bits.
+   * @param[in] background_color Color of the cleared bits.
+   * @return True if the Display was copied, false if it has other colors.
+   */
+  bool save_screen(std::vector<uint8_t> *screen, uint8_t color[], uint8_t background_color[]);
+
+  /**
+   * @brief Draws a whole Display previously copied with save_screen. As any other draw function, only
+   *        the regions that differ from what the Display is showing are sent in the next flush.
+   *
+   * @param[in] screen The bits of the Display.
+   * @param[in] color Color of the set bits.
+   * @param[in] background_color Color of the cleared bits.
+   */
+  void load_screen(const std::vector<uint8_t> &screen, uint8_t color[], uint8_t background_color[]);
+
+  /**
+   * @brief Sends to the display all the regions drawn since the previous flush that have really changed.
+   *        The draw functions only render into the frame buffer, so this function must be called once
+   *        the whole frame has been drawn. The regions are sent by a writer thread, so this function only
+   *        waits for the previous flush to be sent and the next frame can be drawn while this one is sent.
+   */
+  void flush();
+
+  /**
+   * @brief Waits until the display has received everything flushed. Can be called from any thread.
+   */
+  void wait_flush();
+
+  /**
+   * @brief Obtain the average time that the last flushes have taken to reach the display. Can be called from
+   *        any thread.
+   *
+   * @return The time in microseconds.
+   */
+  int get_flush_time_us();
+
+  /**
+   * @brief Ends SPI communications and release all the related resources.
+   */
+  void uninit();
+
+  /**
+   * @brief Class destructor. Calls uninit if the display is still initialized.
+   */
+  ~Display_driver();
+};
+
+/* Exported Functions --------------------------------------------------------*/
 
 #endif /* __DISPLAY_DRIVER_H__ */
@@ -0,0 +1,117 @@
+/**
+  ******************************************************************************
+  * @file   display_transport.cpp
+  * @author Pablo San Millán Fierro (pablo.sanmillanf@alumnos.upm.es)
+  * @brief  Display transport Module.
+  *
+  * @note   End-of-degree work.
+  *         This module defines how Display_driver sends the ST7789 command
+  *         stream. SpidevTransport sends it to the panel through spidev and
+  *         the DC line. Other transports (e.g. HeadlessTransport) allow the
+  *         driver to run without a panel attached.
+  ******************************************************************************
+*/
+
+/* Includes ------------------------------------------------------------------*/
+#include "display_transport.h" // Module header
+
+/* Private defines -----------------------------------------------------------*/
+/* Private typedef -----------------------------------------------------------*/
+/* Private variables----------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+/* Functions -----------------------------------------------------------------*/
+
+/**
+ * @brief Class constructor. Sets the SPI configuration.
+ *
+ * @param[in] spi_device Indicates which SPI device of type spidev0.<number> within the /dev/ directory will be used.
+ * @param[in] dc_pin The GPIO connected to the DC pin of the panel.
+ * @param[in] mode SPI mode.
+ * @param[in] bits Bits per word.
+ * @param[in] speed Speed of the SPI link in Hz.
+ */
+SpidevTransport::SpidevTransport(int spi_device, int dc_pin, int mode, int bits, int speed):
+    spi(dc_pin), spi_device(spi_device), mode(mode), bits(bits), speed(speed){
+}
+
+
+/**
+ * @brief Opens the spidev device and configures the DC line.
+ *
+ * @return 0 if success, -1 if error.
+ */
+int SpidevTransport::start(){
+  return spi.spi_start(spi_device, mode, bits, speed);
+}
+
+
+/**
+ * @brief Sends a block of bytes in one SPI message and waits "delay" microseconds after it.
+ *
+ * @param[in] data The bytes to send. The response of the panel is not read.
+ * @param[in] size The number of bytes.
+ * @param[in] cmd If true, the data sent is a command, if false, it is normal data.
+ * @param[in] delay Microseconds to wait after the data is sent.
+ */
+void SpidevTransport::send(const uint8_t data[], int size, uint8_t cmd, int delay){
+  spi.send_spi_msg((uint8_t*) data, NULL, cmd, size, delay, speed);
+}
+
+
+/**
+ * @brief Sends a group of data blocks as one continuous stream, packed into as few ioctl calls as possible.
+ *
+ * @param[in] segments The data blocks to send, in order.
+ * @param[in] count The number of blocks.
+ * @param[in] cmd If true, the data sent is a command, if false, it is normal data.
+ *
+ * @return 0 if success, -1 if error.
+ */
+int SpidevTransport::send_segments(const SPI_SEGMENT segments[], int count, uint8_t cmd){
+  return spi.send_spi_segments(segments, count, cmd, speed);
+}
+
+
+/**
+ * @brief Sends the same pattern "repetitions" times as one continuous stream.
+ *
+ * @param[in] pattern The bytes to repeat.
+ * @param[in] pattern_size The number of bytes of the pattern.
+ * @param[in] repetitions The number of times the pattern is sent.
+ * @param[in] cmd If true, the data sent is a command, if false, it is normal data.
+ *
+ * @return 0 if success, -1 if error.
+ */
+int SpidevTransport::send_fill(const uint8_t pattern[], int pattern_size, long repetitions, uint8_t cmd){
+  return spi.send_spi_fill(pattern, pattern_size, repetitions, cmd, speed);
+}
+
+
+/**
+ * @brief Obtain the maximum number of bytes that can be sent in one ioctl call (the spidev "bufsiz").
+ *
+ * @return The maximum number of bytes.
+ */
+int SpidevTransport::get_max_transfer_size(){
+  return spi.get_max_transfer_size();
+}
+
+
+/**
+ * @brief Closes the spidev device.
+ *
+ * @return 0 if success, -1 if error.
+ */
+int SpidevTransport::end(){
+  return spi.spi_end();
+}
+
+
+/**
+ * @brief Obtain the SPI link of the panel, e.g. to read its statistics.
+ *
+ * @return The SPI link.
+ */
+SPI_Master &SpidevTransport::get_spi_master(){
+  return spi;
+}
@@ -0,0 +1,130 @@
+/**
+  ******************************************************************************
+  * @file   display_transport.h
+  * @author Pablo San Millán Fierro (pablo.sanmillanf@alumnos.upm.es)
+  * @brief  Display transport Module Header.
+  *
+  * @note   End-of-degree work.
+  *         This module defines how Display_driver sends the ST7789 command
+  *         stream. SpidevTransport sends it to the panel through spidev and
+  *         the DC line. Other transports (e.g. HeadlessTransport) allow the
+  *         driver to run without a panel attached.
+  ******************************************************************************
+*/
+
+#ifndef __DISPLAY_TRANSPORT_H__
+#define __DISPLAY_TRANSPORT_H__
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include "../spi_master/spi_master.h"
+
+/* Exported types ------------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported Classes ----------------------------------------------------------*/
+
+/**
+ * Destination of the bytes generated by Display_driver. The "cmd" parameter of the send functions is the
+ * state of the DC line: if true, the bytes are commands, if false, they are command parameters or pixels.
+ */
+class DisplayTransport{
+public:
+  virtual ~DisplayTransport(){}
+
+  /**
+   * @brief Prepares the transport to send data.
+   *
+   * @return 0 if success, -1 if error.
+   */
+  virtual int start() = 0;
+
+  /**
+   * @brief Sends a block of bytes and waits "delay" microseconds after it.
+   *
+   * @param[in] data The bytes to send.
+   * @param[in] size The number of bytes.
+   * @param[in] cmd If true, the data sent is a command, if false, it is normal data.
+   * @param[in] delay Microseconds to wait after the data is sent.
+   */
+  virtual void send(const uint8_t data[], int size, uint8_t cmd, int delay) = 0;
+
+  /**
+   * @brief Sends a group of data blocks as one continuous stream.
+   *
+   * @param[in] segments The data blocks to send, in order.
+   * @param[in] count The number of blocks.
+   * @param[in] cmd If true, the data sent is a command, if false, it is normal data.
+   *
+   * @return 0 if success, -1 if error.
+   */
+  virtual int send_segments(const SPI_SEGMENT segments[], int count, uint8_t cmd) = 0;
+
+  /**
+   * @brief Sends the same pattern "repetitions" times as one continuous stream.
+   *
+   * @param[in] pattern The bytes to repeat.
+   * @param[in] pattern_size The number of bytes of the pattern.
+   * @param[in] repetitions The number of times the pattern is sent.
+   * @param[in] cmd If true, the data sent is a command, if false, it is normal data.
+   *
+   * @return 0 if success, -1 if error.
+   */
+  virtual int send_fill(const uint8_t pattern[], int pattern_size, long repetitions, uint8_t cmd) = 0;
+
+  /**
+   * @brief Obtain the maximum number of bytes that should be passed to send_segments at once.
+   *
+   * @return The maximum number of bytes.
+   */
+  virtual int get_max_transfer_size() = 0;
+
+  /**
+   * @brief Ends the transport and frees all the related resources.
+   *
+   * @return 0 if success, -1 if error.
+   */
+  virtual int end() = 0;
+};
+
+
+/**
+ * Transport that sends the data to the panel using its own SPI_Master link.
+ */
+class SpidevTransport: public DisplayTransport{
+  SPI_Master spi;
+  int spi_device;
+  int mode;
+  int bits;
+  int speed;
+public:
+
+  /**
+   * @brief Class constructor. Sets the SPI configuration.
+   *
+   * @param[in] spi_device Indicates which SPI device of type spidev0.<number> within the /dev/ directory will be used.
+   * @param[in] dc_pin The GPIO connected to the DC pin of the panel.
+   * @param[in] mode SPI mode.
+   * @param[in] bits Bits per word.
+   * @param[in] speed Speed of the SPI link in Hz.
+   */
+  SpidevTransport(int spi_device, int dc_pin, int mode, int bits, int speed);
+
+  int start() override;
+  void send(const uint8_t data[], int size, uint8_t cmd, int delay) override;
+  int send_segments(const SPI_SEGMENT segments[], int count, uint8_t cmd) override;
+  int send_fill(const uint8_t pattern[], int pattern_size, long repetitions, uint8_t cmd) override;
+  int get_max_transfer_size() override;
+  int end() override;
+
+  /**
+   * @brief Obtain the SPI link of the panel, e.g. to read its statistics.
+   *
+   * @return The SPI link.
+   */
+  SPI_Master &get_spi_master();
+};
+
+/* Exported Functions --------------------------------------------------------*/
+
+#endif /* __DISPLAY_TRANSPORT_H__ */
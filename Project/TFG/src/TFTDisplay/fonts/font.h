@@ -0,0 +1,54 @@
+/**
+  ******************************************************************************
+  * @file   font.h
+  * @author Pablo San Millán Fierro (pablo.sanmillanf@alumnos.upm.es)
+  * @brief  Byte-aligned font format Header.
+  *
+  * @note   End-of-degree work.
+  *         The fonts are generated from Adafruit GFX fonts by
+  *         tools/font_compiler.py into font_bitmaps.h. Unlike the GFX format,
+  *         every glyph row starts at a byte boundary, so the rows can be
+  *         expanded a whole byte at a time.
+  ******************************************************************************
+*/
+
+#ifndef __FONT_H__
+#define __FONT_H__
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+ * Glyph of a character. The glyph rows take (width + 7) / 8 bytes each.
+ */
+typedef struct{
+  uint16_t bitmap_offset;   //Byte of Font::bitmap where the first row of the glyph starts
+  uint8_t width;            //Bitmap dimensions in pixels
+  uint8_t height;
+  uint8_t x_advance;        //Distance to advance the cursor (x axis)
+  int8_t x_offset;          //Distance from the cursor to the upper left corner of the bitmap
+  int8_t y_offset;
+  uint8_t inside_cell;      //1 if the bitmap stays inside the advance cell, so it can be drawn with its background
+}FontGlyph;
+
+/**
+ * Font. The characters from "first" to "last" have a glyph; the ones left out of the font have an empty
+ * glyph that doesn't advance the cursor.
+ */
+typedef struct{
+  const uint8_t *bitmap;    //Glyph rows, padded to a whole byte. The MSB is the leftmost pixel
+  const FontGlyph *glyph;   //Glyphs from "first" to "last"
+  uint8_t first;
+  uint8_t last;
+  uint8_t y_advance;        //Newline distance (y axis)
+  uint8_t ascent;           //Rows of the highest glyph above the line where the text is written
+  uint8_t descent;          //Rows of the lowest glyph below that line
+}Font;
+
+/* Exported constants --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported Functions --------------------------------------------------------*/
+
+#endif /* __FONT_H__ */
@@ -0,0 +1,854 @@
+/**
+  ******************************************************************************
+  * @file   font_bitmaps.h
+  * @brief  Byte-aligned application fonts.
+  *
+  * @note   Automatically generated by tools/font_compiler.py. Do not edit!
+  *         Glyph rows are padded to a whole byte and MSB is the leftmost
+  *         pixel. Characters left out of a font have an empty glyph.
+  ******************************************************************************
+*/
+
+#ifndef __FONT_BITMAPS_H__
+#define __FONT_BITMAPS_H__
+
+#include <cstdint>
+#include "font.h"
+
+// FreeSansBold12pt7b.h: 95 glyphs from 0x20 to 0x7E, 2706 bitmap bytes
+inline constexpr uint8_t FreeSansBold12pt7bBitmaps[] = {
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x70, 0x60, 0x60, 0x60, 0x60, 0x00, 0xf0, 0xf0,
+    0xf0, 0xf3, 0xc0, 0xf3, 0xc0, 0xf3, 0xc0, 0xf3, 0xc0, 0x61, 0x80, 0x61, 0x80, 0x0e, 0x70, 0x0e,
+    0x70, 0x0c, 0x60, 0x7f, 0xf8, 0x7f, 0xf8, 0x7f, 0xf8, 0x1c, 0xe0, 0x18, 0xc0, 0x18, 0xc0, 0xff,
+    0xf0, 0xff, 0xf0, 0xff, 0xf0, 0x31, 0x80, 0x73, 0x80, 0x73, 0x80, 0x73, 0x80, 0x02, 0x00, 0x0f,
+    0xc0, 0x3f, 0xe0, 0x3f, 0xf0, 0x7a, 0xf8, 0x72, 0x78, 0x72, 0x00, 0x7a, 0x00, 0x3f, 0x00, 0x1f,
+    0xe0, 0x03, 0xf0, 0x02, 0xf8, 0xf2, 0x78, 0xf2, 0x78, 0xfa, 0xf8, 0x7f, 0xf0, 0x3f, 0xe0, 0x0f,
+    0x80, 0x02, 0x00, 0x02, 0x00, 0x3c, 0x06, 0x00, 0x7e, 0x0c, 0x00, 0x7f, 0x0c, 0x00, 0xe7, 0x18,
+    0x00, 0xc3, 0x18, 0x00, 0xe7, 0x30, 0x00, 0x7f, 0x30, 0x00, 0x7e, 0x60, 0x00, 0x3c, 0x67, 0x80,
+    0x00, 0xcf, 0xc0, 0x00, 0x9f, 0xe0, 0x01, 0x9c, 0xe0, 0x01, 0x18, 0x60, 0x03, 0x1c, 0xe0, 0x06,
+    0x1f, 0xe0, 0x06, 0x0f, 0xc0, 0x0c, 0x07, 0x80, 0x07, 0x80, 0x1f, 0xc0, 0x3f, 0xe0, 0x3c, 0xe0,
+    0x3c, 0xe0, 0x3e, 0xe0, 0x0f, 0xc0, 0x07, 0x00, 0x3f, 0x8c, 0x7f, 0xcc, 0xf1, 0xfc, 0xf0, 0xf8,
+    0xf0, 0x78, 0xf8, 0xf8, 0x7f, 0xfc, 0x3f, 0xde, 0x1f, 0x8e, 0xf0, 0xf0, 0xf0, 0xf0, 0x60, 0x60,
+    0x0c, 0x1c, 0x38, 0x38, 0x70, 0x70, 0x70, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0x70,
+    0x70, 0x70, 0x38, 0x38, 0x18, 0x1c, 0xc0, 0xe0, 0x70, 0x70, 0x38, 0x38, 0x38, 0x1c, 0x1c, 0x1c,
+    0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x38, 0x38, 0x38, 0x70, 0x70, 0x60, 0xe0, 0x10, 0x10, 0xd6, 0xfe,
+    0x38, 0x38, 0x6c, 0x28, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0xff, 0xe0, 0xff, 0xe0,
+    0xff, 0xe0, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0xf0, 0xf0, 0xf0, 0x30, 0x30, 0x60,
+    0xc0, 0xfc, 0xfc, 0xfc, 0xf0, 0xf0, 0xf0, 0x0c, 0x0c, 0x08, 0x18, 0x18, 0x18, 0x10, 0x30, 0x30,
+    0x30, 0x20, 0x60, 0x60, 0x60, 0x40, 0xc0, 0xc0, 0x1f, 0x80, 0x3f, 0xc0, 0x7f, 0xe0, 0x79, 0xe0,
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0x79, 0xe0, 0x7f, 0xe0, 0x3f, 0xc0, 0x0f, 0x00, 0x06, 0x0e, 0x1e, 0xfe, 0xfe, 0x1e,
+    0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1f, 0x80, 0x3f, 0xc0, 0x7f,
+    0xe0, 0xf9, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x01, 0xe0, 0x03, 0xc0, 0x0f,
+    0x80, 0x1e, 0x00, 0x3c, 0x00, 0x38, 0x00, 0x7f, 0xf0, 0x7f, 0xf0, 0x7f, 0xf0, 0x1f, 0x00, 0x7f,
+    0xc0, 0xff, 0xe0, 0xf1, 0xe0, 0xf1, 0xe0, 0x01, 0xe0, 0x03, 0xc0, 0x07, 0x80, 0x07, 0xc0, 0x01,
+    0xe0, 0x00, 0xf0, 0x00, 0xf0, 0xf0, 0xf0, 0xf1, 0xf0, 0x7f, 0xe0, 0x7f, 0xc0, 0x1f, 0x80, 0x03,
+    0xc0, 0x07, 0xc0, 0x07, 0xc0, 0x0f, 0xc0, 0x1b, 0xc0, 0x13, 0xc0, 0x33, 0xc0, 0x63, 0xc0, 0x63,
+    0xc0, 0xc3, 0xc0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+    0xc0, 0x3f, 0xe0, 0x7f, 0xe0, 0x7f, 0xe0, 0x70, 0x00, 0x60, 0x00, 0x6f, 0x80, 0x7f, 0xc0, 0xff,
+    0xe0, 0xf1, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0xe1, 0xe0, 0xff, 0xe0, 0x7f,
+    0xc0, 0x3f, 0x00, 0x0f, 0x80, 0x3f, 0xc0, 0x7f, 0xe0, 0x79, 0xf0, 0xf0, 0x00, 0xf7, 0x80, 0xff,
+    0xc0, 0xff, 0xe0, 0xf9, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x79, 0xf0, 0x7f,
+    0xe0, 0x3f, 0xc0, 0x0f, 0x80, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0x01, 0xc0, 0x01, 0xc0, 0x03,
+    0x80, 0x07, 0x80, 0x07, 0x00, 0x0f, 0x00, 0x0e, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x1c,
+    0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x0f, 0x00, 0x3f, 0xc0, 0x7f, 0xc0, 0x79, 0xe0, 0x70,
+    0xe0, 0x70, 0xe0, 0x39, 0xc0, 0x1f, 0x80, 0x3f, 0xc0, 0x79, 0xe0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+    0xf0, 0xf9, 0xf0, 0x7f, 0xe0, 0x3f, 0xc0, 0x1f, 0x80, 0x1f, 0x00, 0x3f, 0xc0, 0x7f, 0xe0, 0xf9,
+    0xe0, 0xf0, 0xe0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf9, 0xf0, 0x7f, 0xf0, 0x3f, 0xf0, 0x1e,
+    0xf0, 0x00, 0xe0, 0xf1, 0xe0, 0x7f, 0xe0, 0x7f, 0xc0, 0x1f, 0x00, 0xf0, 0xf0, 0xf0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xf0, 0xf0, 0xf0, 0x10, 0x10, 0x60, 0xc0, 0x00, 0x10, 0x00, 0x70, 0x03, 0xf0, 0x1f, 0xc0, 0x7e,
+    0x00, 0xf8, 0x00, 0xe0, 0x00, 0xfc, 0x00, 0x3f, 0x80, 0x07, 0xf0, 0x00, 0xf0, 0x00, 0x30, 0xff,
+    0xf0, 0xff, 0xf0, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0xff,
+    0xf0, 0x00, 0x00, 0xe0, 0x00, 0xfc, 0x00, 0x7f, 0x00, 0x0f, 0xe0, 0x01, 0xf0, 0x00, 0xf0, 0x07,
+    0xf0, 0x1f, 0x80, 0xfe, 0x00, 0xf0, 0x00, 0x80, 0x00, 0x1f, 0x00, 0x7f, 0xc0, 0x7f, 0xe0, 0xf9,
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x01, 0xe0, 0x03, 0xc0, 0x07, 0x80, 0x0f,
+    0x00, 0x0e, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x00, 0xfe, 0x00,
+    0x03, 0xff, 0x80, 0x0f, 0x03, 0xc0, 0x1c, 0x00, 0xe0, 0x38, 0x00, 0x70, 0x30, 0x7b, 0x30, 0x61,
+    0xfb, 0x18, 0x63, 0x8e, 0x18, 0xc3, 0x06, 0x18, 0xc3, 0x06, 0x18, 0xc6, 0x06, 0x18, 0xc6, 0x0c,
+    0x38, 0xc6, 0x0c, 0x30, 0xc7, 0x1c, 0x70, 0xe3, 0xf7, 0xe0, 0x61, 0xe7, 0x80, 0x70, 0x00, 0x00,
+    0x38, 0x00, 0x00, 0x1e, 0x02, 0x00, 0x0f, 0xff, 0x00, 0x01, 0xfc, 0x00, 0x03, 0xe0, 0x03, 0xe0,
+    0x03, 0xe0, 0x07, 0xf0, 0x07, 0xf0, 0x07, 0x70, 0x0f, 0x78, 0x0e, 0x78, 0x0e, 0x38, 0x1e, 0x3c,
+    0x1c, 0x3c, 0x3f, 0xfc, 0x3f, 0xfe, 0x3f, 0xfe, 0x78, 0x0e, 0x78, 0x0f, 0x70, 0x0f, 0xf0, 0x07,
+    0xff, 0xc0, 0xff, 0xf0, 0xff, 0xf0, 0xf0, 0xf8, 0xf0, 0x78, 0xf0, 0x78, 0xf0, 0xf8, 0xff, 0xf0,
+    0xff, 0xe0, 0xff, 0xf0, 0xf0, 0x78, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x7c, 0xff, 0xf8,
+    0xff, 0xf8, 0xff, 0xe0, 0x07, 0xe0, 0x1f, 0xf8, 0x3f, 0xfc, 0x7c, 0x3e, 0x78, 0x1f, 0xf8, 0x0f,
+    0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf8, 0x0f, 0x78, 0x1f,
+    0x7c, 0x3e, 0x3f, 0xfe, 0x1f, 0xfc, 0x07, 0xf0, 0xff, 0xe0, 0xff, 0xf0, 0xff, 0xf8, 0xf0, 0x7c,
+    0xf0, 0x3c, 0xf0, 0x3e, 0xf0, 0x1e, 0xf0, 0x1e, 0xf0, 0x1e, 0xf0, 0x1e, 0xf0, 0x1e, 0xf0, 0x1e,
+    0xf0, 0x3e, 0xf0, 0x3c, 0xf0, 0x7c, 0xff, 0xf8, 0xff, 0xf0, 0xff, 0xc0, 0xff, 0xf0, 0xff, 0xf0,
+    0xff, 0xf0, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0,
+    0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8,
+    0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xff, 0xe0,
+    0xff, 0xe0, 0xff, 0xe0, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00,
+    0xf0, 0x00, 0xf0, 0x00, 0x03, 0xf0, 0x0f, 0xfc, 0x3f, 0xfe, 0x3e, 0x1f, 0x78, 0x07, 0x78, 0x00,
+    0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x7f, 0xf0, 0x7f, 0xf0, 0x7f, 0xf0, 0x07, 0x78, 0x07, 0x7c, 0x0f,
+    0x3e, 0x1f, 0x3f, 0xfb, 0x0f, 0xfb, 0x03, 0xe3, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c,
+    0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xf0, 0x3c, 0xf0, 0x3c,
+    0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x01, 0xe0,
+    0x01, 0xe0, 0x01, 0xe0, 0x01, 0xe0, 0x01, 0xe0, 0x01, 0xe0, 0x01, 0xe0, 0x01, 0xe0, 0x01, 0xe0,
+    0x01, 0xe0, 0x01, 0xe0, 0xf1, 0xe0, 0xf1, 0xe0, 0xf1, 0xe0, 0xf1, 0xe0, 0x7f, 0xc0, 0x7f, 0xc0,
+    0x1f, 0x00, 0xf0, 0x3e, 0xf0, 0x3c, 0xf0, 0x78, 0xf0, 0xf0, 0xf1, 0xe0, 0xf3, 0xc0, 0xf7, 0x80,
+    0xff, 0x00, 0xff, 0x80, 0xff, 0x80, 0xfb, 0xc0, 0xf1, 0xe0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x78,
+    0xf0, 0x3c, 0xf0, 0x3e, 0xf0, 0x1e, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00,
+    0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00,
+    0xf0, 0x00, 0xf0, 0x00, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xf8, 0x1f, 0x80, 0xfc, 0x1f, 0x80,
+    0xfc, 0x3f, 0x80, 0xfc, 0x3f, 0x80, 0xfc, 0x3f, 0x80, 0xfc, 0x3f, 0x80, 0xfe, 0x7f, 0x80, 0xfe,
+    0x77, 0x80, 0xfe, 0x77, 0x80, 0xf6, 0x77, 0x80, 0xf7, 0x77, 0x80, 0xf7, 0xe7, 0x80, 0xf7, 0xe7,
+    0x80, 0xf3, 0xe7, 0x80, 0xf3, 0xe7, 0x80, 0xf3, 0xc7, 0x80, 0xf3, 0xc7, 0x80, 0xf1, 0xc7, 0x80,
+    0xf0, 0x1e, 0xf8, 0x1e, 0xfc, 0x1e, 0xfc, 0x1e, 0xfe, 0x1e, 0xfe, 0x1e, 0xf7, 0x1e, 0xf7, 0x1e,
+    0xf3, 0x9e, 0xf3, 0x9e, 0xf1, 0xde, 0xf1, 0xfe, 0xf0, 0xfe, 0xf0, 0xfe, 0xf0, 0x7e, 0xf0, 0x3e,
+    0xf0, 0x3e, 0xf0, 0x1e, 0x03, 0xe0, 0x00, 0x1f, 0xf8, 0x00, 0x3f, 0xfe, 0x00, 0x3e, 0x3e, 0x00,
+    0x78, 0x0f, 0x00, 0x78, 0x0f, 0x00, 0xf0, 0x07, 0x80, 0xf0, 0x07, 0x80, 0xf0, 0x07, 0x80, 0xf0,
+    0x07, 0x80, 0xf0, 0x07, 0x80, 0xf0, 0x07, 0x80, 0x78, 0x0f, 0x00, 0x78, 0x0f, 0x00, 0x3c, 0x3e,
+    0x00, 0x3f, 0xfe, 0x00, 0x1f, 0xfc, 0x00, 0x07, 0xf0, 0x00, 0xff, 0xe0, 0xff, 0xf8, 0xff, 0xf8,
+    0xf0, 0x7c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x7c, 0xff, 0xf8, 0xff, 0xf0, 0xff, 0xe0,
+    0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0x03, 0xe0,
+    0x00, 0x1f, 0xf8, 0x00, 0x3f, 0xfe, 0x00, 0x3e, 0x3e, 0x00, 0x78, 0x0f, 0x00, 0x78, 0x0f, 0x00,
+    0xf0, 0x07, 0x80, 0xf0, 0x07, 0x80, 0xf0, 0x07, 0x80, 0xf0, 0x07, 0x80, 0xf0, 0x07, 0x80, 0xf0,
+    0x27, 0x80, 0x78, 0x7f, 0x00, 0x78, 0x7f, 0x00, 0x3c, 0x3e, 0x00, 0x3f, 0xfe, 0x00, 0x1f, 0xff,
+    0x80, 0x07, 0xe3, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf8, 0xff, 0xfc, 0xff, 0xfc, 0xf0, 0x3e, 0xf0,
+    0x1e, 0xf0, 0x1e, 0xf0, 0x1e, 0xf0, 0x3c, 0xff, 0xf8, 0xff, 0xf0, 0xff, 0xf8, 0xf0, 0x3c, 0xf0,
+    0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x1f, 0x0f, 0xc0, 0x3f, 0xf0, 0x7f,
+    0xf8, 0xf8, 0x7c, 0xf0, 0x3c, 0xf0, 0x00, 0xf0, 0x00, 0xfe, 0x00, 0x7f, 0xf0, 0x1f, 0xfc, 0x03,
+    0xfe, 0x00, 0x3e, 0x00, 0x1e, 0xf0, 0x1e, 0x78, 0x3e, 0x7f, 0xfc, 0x3f, 0xf8, 0x0f, 0xe0, 0xff,
+    0xf0, 0xff, 0xf0, 0xff, 0xf0, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f,
+    0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f,
+    0x00, 0x0f, 0x00, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0,
+    0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0xf0, 0x3c, 0x78,
+    0x78, 0x7f, 0xf8, 0x3f, 0xf0, 0x0f, 0xc0, 0x70, 0x0e, 0x78, 0x1e, 0x78, 0x1e, 0x38, 0x1c, 0x38,
+    0x1c, 0x3c, 0x3c, 0x1c, 0x38, 0x1c, 0x38, 0x1e, 0x78, 0x0e, 0x70, 0x0e, 0x70, 0x0e, 0x70, 0x07,
+    0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x70, 0x38, 0x1c, 0x70, 0x78,
+    0x3c, 0x78, 0x7c, 0x3c, 0x78, 0x7c, 0x3c, 0x38, 0x7c, 0x38, 0x38, 0x7c, 0x38, 0x38, 0xee, 0x78,
+    0x3c, 0xee, 0x70, 0x1c, 0xee, 0x70, 0x1c, 0xe6, 0x70, 0x1c, 0xe6, 0x70, 0x0d, 0xc7, 0xe0, 0x0f,
+    0xc7, 0xe0, 0x0f, 0xc7, 0xe0, 0x0f, 0xc3, 0xe0, 0x07, 0xc3, 0xc0, 0x07, 0x83, 0xc0, 0x07, 0x83,
+    0xc0, 0xf0, 0x3c, 0x78, 0x7c, 0x78, 0x78, 0x3c, 0xf0, 0x3c, 0xf0, 0x1f, 0xe0, 0x0f, 0xc0, 0x0f,
+    0xc0, 0x07, 0x80, 0x07, 0x80, 0x0f, 0xc0, 0x1f, 0xe0, 0x1f, 0xe0, 0x3c, 0xf0, 0x3c, 0x78, 0x78,
+    0x78, 0xf8, 0x3c, 0xf0, 0x3c, 0xf0, 0x1e, 0x78, 0x1e, 0x78, 0x3c, 0x3c, 0x3c, 0x3c, 0x78, 0x1e,
+    0x78, 0x0e, 0x70, 0x0f, 0xf0, 0x07, 0xe0, 0x07, 0xe0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03,
+    0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0x00,
+    0xf8, 0x00, 0xf0, 0x01, 0xe0, 0x03, 0xc0, 0x07, 0xc0, 0x07, 0x80, 0x0f, 0x00, 0x1e, 0x00, 0x3e,
+    0x00, 0x3c, 0x00, 0x78, 0x00, 0xf0, 0x00, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xfc, 0xfc, 0xfc,
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+    0xf0, 0xfc, 0xfc, 0xfc, 0xc0, 0xc0, 0x40, 0x60, 0x60, 0x20, 0x30, 0x30, 0x10, 0x18, 0x18, 0x08,
+    0x0c, 0x0c, 0x04, 0x06, 0x06, 0xfc, 0xfc, 0xfc, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0xfc, 0xfc, 0xfc, 0x0f, 0x00, 0x0f, 0x00,
+    0x0f, 0x00, 0x1f, 0x80, 0x1b, 0x80, 0x39, 0xc0, 0x39, 0xc0, 0x30, 0xc0, 0x70, 0xe0, 0x70, 0xe0,
+    0xe0, 0x70, 0xff, 0xfe, 0xff, 0xfe, 0xe0, 0x60, 0x30, 0x1f, 0x80, 0x7f, 0xe0, 0x7f, 0xf0, 0xf0,
+    0xf0, 0x00, 0xf0, 0x07, 0xf0, 0x7f, 0xf0, 0xf8, 0xf0, 0xf0, 0xf0, 0xf1, 0xf0, 0xff, 0xf0, 0x7f,
+    0xf0, 0x3c, 0xf8, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf7, 0x80, 0xff,
+    0xe0, 0xff, 0xf0, 0xf8, 0xf0, 0xf0, 0x78, 0xf0, 0x78, 0xf0, 0x78, 0xf0, 0x78, 0xf0, 0x78, 0xf8,
+    0xf0, 0xff, 0xf0, 0xff, 0xe0, 0xf7, 0xc0, 0x0f, 0x80, 0x3f, 0xe0, 0x7f, 0xf0, 0x78, 0xf0, 0xf0,
+    0x70, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x70, 0x78, 0xf0, 0x7f, 0xf0, 0x3f, 0xe0, 0x0f,
+    0x80, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x1f, 0x78, 0x3f, 0xf8, 0x7f,
+    0xf8, 0x78, 0xf8, 0xf0, 0x78, 0xf0, 0x78, 0xf0, 0x78, 0xf0, 0x78, 0xf0, 0x78, 0x78, 0xf8, 0x7f,
+    0xf8, 0x3f, 0xf8, 0x1f, 0x78, 0x1f, 0x80, 0x3f, 0xc0, 0x7f, 0xe0, 0xf8, 0xe0, 0xf0, 0x70, 0xff,
+    0xf0, 0xff, 0xf0, 0xf0, 0x00, 0xf0, 0x00, 0x78, 0x70, 0x7f, 0xf0, 0x3f, 0xe0, 0x0f, 0x80, 0x3e,
+    0x7e, 0x7e, 0x78, 0x78, 0xfc, 0xfc, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78,
+    0x78, 0x1e, 0x78, 0x3f, 0x78, 0x7f, 0xf8, 0x78, 0xf8, 0xf0, 0x78, 0xf0, 0x78, 0xf0, 0x78, 0xf0,
+    0x78, 0xf0, 0x78, 0xf8, 0xf8, 0x7f, 0xf8, 0x3f, 0xf8, 0x1f, 0x78, 0x00, 0x78, 0x00, 0x78, 0xf8,
+    0xf0, 0x7f, 0xf0, 0x1f, 0xc0, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf7,
+    0xc0, 0xff, 0xe0, 0xff, 0xf0, 0xf9, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x3c, 0x3c, 0x3c, 0x00, 0x00,
+    0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0xfc,
+    0xfc, 0xf8, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0xf0, 0xf1, 0xe0,
+    0xf3, 0xc0, 0xf7, 0x80, 0xff, 0x00, 0xff, 0x00, 0xff, 0x80, 0xff, 0x80, 0xf3, 0xc0, 0xf1, 0xc0,
+    0xf1, 0xe0, 0xf0, 0xe0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf7, 0x8f, 0x80, 0xff, 0xdf, 0xc0, 0xff, 0xff,
+    0xe0, 0xf9, 0xf1, 0xe0, 0xf1, 0xe1, 0xe0, 0xf1, 0xe1, 0xe0, 0xf1, 0xe1, 0xe0, 0xf1, 0xe1, 0xe0,
+    0xf1, 0xe1, 0xe0, 0xf1, 0xe1, 0xe0, 0xf1, 0xe1, 0xe0, 0xf1, 0xe1, 0xe0, 0xf1, 0xe1, 0xe0, 0xf7,
+    0xc0, 0xff, 0xe0, 0xff, 0xf0, 0xf9, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x0f, 0x80, 0x3f, 0xe0, 0x7f, 0xf0, 0x78,
+    0xf0, 0xf0, 0x78, 0xf0, 0x78, 0xf0, 0x78, 0xf0, 0x78, 0xf0, 0x78, 0x78, 0xf0, 0x7f, 0xf0, 0x3f,
+    0xe0, 0x0f, 0x80, 0xf7, 0xc0, 0xff, 0xe0, 0xff, 0xf0, 0xf8, 0xf0, 0xf0, 0x78, 0xf0, 0x78, 0xf0,
+    0x78, 0xf0, 0x78, 0xf0, 0x78, 0xf8, 0xf0, 0xff, 0xf0, 0xff, 0xe0, 0xf7, 0x80, 0xf0, 0x00, 0xf0,
+    0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0x0f, 0x78, 0x3f, 0xf8, 0x7f, 0xf8, 0x78, 0xf8, 0xf0,
+    0x78, 0xf0, 0x78, 0xf0, 0x78, 0xf0, 0x78, 0xf0, 0x78, 0x78, 0xf8, 0x7f, 0xf8, 0x3f, 0xf8, 0x1f,
+    0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0xf3, 0xf7, 0xff, 0xf8, 0xf0,
+    0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x1f, 0x80, 0x7f, 0xc0, 0xff, 0xe0, 0xf0, 0xf0,
+    0xf8, 0x00, 0xff, 0x00, 0x7f, 0xe0, 0x0f, 0xf0, 0x01, 0xf0, 0xf0, 0xf0, 0xff, 0xe0, 0x7f, 0xe0,
+    0x1f, 0x80, 0x78, 0x78, 0x78, 0xfc, 0xfc, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x7c, 0x7c,
+    0x3c, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+    0xf0, 0xf0, 0xf0, 0xf1, 0xf0, 0xff, 0xf0, 0x7f, 0xf0, 0x3e, 0xf0, 0xf0, 0x78, 0x70, 0x70, 0x78,
+    0x70, 0x78, 0xf0, 0x38, 0xe0, 0x38, 0xe0, 0x1d, 0xe0, 0x1d, 0xc0, 0x1d, 0xc0, 0x0f, 0xc0, 0x0f,
+    0x80, 0x0f, 0x80, 0x07, 0x00, 0xf0, 0xe1, 0xc0, 0x71, 0xe1, 0xc0, 0x71, 0xf3, 0xc0, 0x79, 0xf3,
+    0xc0, 0x79, 0xb3, 0x80, 0x39, 0xb3, 0x80, 0x3b, 0xb3, 0x80, 0x3b, 0xbf, 0x00, 0x1f, 0x3f, 0x00,
+    0x1f, 0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x1f, 0x1e, 0x00, 0x0e, 0x1e, 0x00, 0x78, 0xf0, 0x78, 0xf0,
+    0x3d, 0xe0, 0x1d, 0xc0, 0x1f, 0xc0, 0x0f, 0x80, 0x07, 0x80, 0x0f, 0x80, 0x1f, 0xc0, 0x1d, 0xe0,
+    0x3d, 0xe0, 0x78, 0xf0, 0x78, 0x70, 0xf0, 0x78, 0x70, 0x70, 0x78, 0x70, 0x38, 0xf0, 0x38, 0xe0,
+    0x3c, 0xe0, 0x1c, 0xe0, 0x1d, 0xc0, 0x1f, 0xc0, 0x0f, 0xc0, 0x0f, 0x80, 0x07, 0x80, 0x07, 0x00,
+    0x07, 0x00, 0x0f, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3c, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0,
+    0x03, 0xc0, 0x07, 0x80, 0x0f, 0x00, 0x1e, 0x00, 0x3c, 0x00, 0x78, 0x00, 0xf0, 0x00, 0xff, 0xc0,
+    0xff, 0xc0, 0xff, 0xc0, 0x1c, 0x3c, 0x3c, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0xf0,
+    0xf0, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3c, 0x3c, 0x1c, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+    0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+    0xc0, 0xe0, 0xe0, 0xf0, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x3c, 0x3c, 0x70, 0x70,
+    0x70, 0x70, 0x70, 0x70, 0x70, 0xf0, 0xf0, 0xe0, 0x78, 0x00, 0xfe, 0x00, 0xcf, 0x30, 0x07, 0xf0,
+    0x01, 0xe0,
+};
+
+inline constexpr FontGlyph FreeSansBold12pt7bGlyphs[] = {
+    {0, 0, 0, 7, 0, 1, 1},   // 0x20 ' '
+    {0, 4, 17, 8, 3, -16, 1},   // 0x21 '!'
+    {17, 10, 6, 11, 1, -17, 1},   // 0x22 '"'
+    {29, 13, 16, 13, 0, -15, 1},   // 0x23 '#'
+    {61, 13, 20, 13, 0, -17, 1},   // 0x24 '$'
+    {101, 19, 17, 21, 1, -16, 1},   // 0x25 '%'
+    {152, 16, 17, 17, 1, -16, 1},   // 0x26 '&'
+    {186, 4, 6, 6, 1, -17, 1},   // 0x27 '''
+    {192, 6, 22, 8, 1, -17, 1},   // 0x28 '('
+    {214, 6, 22, 8, 1, -17, 1},   // 0x29 ')'
+    {236, 7, 8, 9, 1, -17, 1},   // 0x2A '*'
+    {244, 11, 11, 14, 2, -10, 1},   // 0x2B '+'
+    {266, 4, 7, 6, 1, -2, 1},   // 0x2C ','
+    {273, 6, 3, 8, 1, -7, 1},   // 0x2D '-'
+    {276, 4, 3, 6, 1, -2, 1},   // 0x2E '.'
+    {279, 6, 17, 7, 0, -16, 1},   // 0x2F '/'
+    {296, 12, 17, 13, 1, -16, 1},   // 0x30 '0'
+    {330, 7, 17, 14, 3, -16, 1},   // 0x31 '1'
+    {347, 12, 17, 13, 1, -16, 1},   // 0x32 '2'
+    {381, 12, 17, 13, 1, -16, 1},   // 0x33 '3'
+    {415, 11, 17, 13, 1, -16, 1},   // 0x34 '4'
+    {449, 12, 17, 13, 1, -16, 1},   // 0x35 '5'
+    {483, 12, 17, 13, 1, -16, 1},   // 0x36 '6'
+    {517, 11, 17, 13, 1, -16, 1},   // 0x37 '7'
+    {551, 12, 17, 13, 1, -16, 1},   // 0x38 '8'
+    {585, 12, 17, 13, 1, -16, 1},   // 0x39 '9'
+    {619, 4, 12, 6, 1, -11, 1},   // 0x3A ':'
+    {631, 4, 16, 6, 1, -11, 1},   // 0x3B ';'
+    {647, 12, 12, 14, 1, -11, 1},   // 0x3C '<'
+    {671, 12, 9, 14, 1, -9, 1},   // 0x3D '='
+    {689, 12, 12, 14, 1, -11, 1},   // 0x3E '>'
+    {713, 12, 18, 15, 2, -17, 1},   // 0x3F '?'
+    {749, 21, 21, 23, 1, -17, 1},   // 0x40 '@'
+    {812, 16, 18, 17, 0, -17, 1},   // 0x41 'A'
+    {848, 14, 18, 17, 2, -17, 1},   // 0x42 'B'
+    {884, 16, 18, 17, 1, -17, 1},   // 0x43 'C'
+    {920, 15, 18, 17, 2, -17, 1},   // 0x44 'D'
+    {956, 13, 18, 16, 2, -17, 1},   // 0x45 'E'
+    {992, 12, 18, 15, 2, -17, 1},   // 0x46 'F'
+    {1028, 16, 18, 18, 1, -17, 1},   // 0x47 'G'
+    {1064, 14, 18, 18, 2, -17, 1},   // 0x48 'H'
+    {1100, 4, 18, 7, 2, -17, 1},   // 0x49 'I'
+    {1118, 11, 18, 14, 1, -17, 1},   // 0x4A 'J'
+    {1154, 16, 18, 17, 2, -17, 0},   // 0x4B 'K'
+    {1190, 11, 18, 15, 2, -17, 1},   // 0x4C 'L'
+    {1226, 17, 18, 21, 2, -17, 1},   // 0x4D 'M'
+    {1280, 15, 18, 18, 2, -17, 1},   // 0x4E 'N'
+    {1316, 17, 18, 19, 1, -17, 1},   // 0x4F 'O'
+    {1370, 14, 18, 16, 2, -17, 1},   // 0x50 'P'
+    {1406, 17, 19, 19, 1, -17, 1},   // 0x51 'Q'
+    {1463, 16, 18, 17, 2, -17, 0},   // 0x52 'R'
+    {1499, 15, 18, 16, 1, -17, 1},   // 0x53 'S'
+    {1535, 12, 18, 15, 2, -17, 1},   // 0x54 'T'
+    {1571, 14, 18, 18, 2, -17, 1},   // 0x55 'U'
+    {1607, 15, 18, 16, 0, -17, 1},   // 0x56 'V'
+    {1643, 23, 18, 23, 0, -17, 1},   // 0x57 'W'
+    {1697, 15, 18, 16, 1, -17, 1},   // 0x58 'X'
+    {1733, 16, 18, 15, 0, -17, 0},   // 0x59 'Y'
+    {1769, 13, 18, 15, 1, -17, 1},   // 0x5A 'Z'
+    {1805, 6, 23, 8, 2, -17, 1},   // 0x5B '['
+    {1828, 7, 17, 7, 0, -16, 1},   // 0x5C '\\'
+    {1845, 6, 23, 8, 0, -17, 1},   // 0x5D ']'
+    {1868, 12, 11, 14, 1, -16, 1},   // 0x5E '^'
+    {1890, 15, 2, 13, -1, 4, 0},   // 0x5F '_'
+    {1894, 4, 3, 6, 0, -17, 1},   // 0x60 '`'
+    {1897, 13, 13, 14, 1, -12, 1},   // 0x61 'a'
+    {1923, 13, 18, 15, 2, -17, 1},   // 0x62 'b'
+    {1959, 12, 13, 13, 1, -12, 1},   // 0x63 'c'
+    {1985, 13, 18, 15, 1, -17, 1},   // 0x64 'd'
+    {2021, 13, 13, 14, 1, -12, 1},   // 0x65 'e'
+    {2047, 7, 18, 8, 1, -17, 1},   // 0x66 'f'
+    {2065, 13, 18, 15, 1, -12, 1},   // 0x67 'g'
+    {2101, 12, 18, 14, 2, -17, 1},   // 0x68 'h'
+    {2137, 4, 18, 7, 2, -17, 1},   // 0x69 'i'
+    {2155, 6, 23, 7, 0, -17, 1},   // 0x6A 'j'
+    {2178, 12, 18, 14, 2, -17, 1},   // 0x6B 'k'
+    {2214, 4, 18, 6, 2, -17, 1},   // 0x6C 'l'
+    {2232, 19, 13, 21, 2, -12, 1},   // 0x6D 'm'
+    {2271, 12, 13, 15, 2, -12, 1},   // 0x6E 'n'
+    {2297, 13, 13, 15, 1, -12, 1},   // 0x6F 'o'
+    {2323, 13, 18, 15, 2, -12, 1},   // 0x70 'p'
+    {2359, 13, 18, 15, 1, -12, 1},   // 0x71 'q'
+    {2395, 8, 13, 9, 2, -12, 0},   // 0x72 'r'
+    {2408, 12, 13, 13, 1, -12, 1},   // 0x73 's'
+    {2434, 6, 15, 8, 1, -14, 1},   // 0x74 't'
+    {2449, 12, 13, 15, 2, -12, 1},   // 0x75 'u'
+    {2475, 13, 13, 13, 0, -12, 1},   // 0x76 'v'
+    {2501, 18, 13, 19, 0, -12, 1},   // 0x77 'w'
+    {2540, 13, 13, 13, 0, -12, 1},   // 0x78 'x'
+    {2566, 13, 18, 13, 0, -12, 1},   // 0x79 'y'
+    {2602, 10, 13, 12, 1, -12, 1},   // 0x7A 'z'
+    {2628, 6, 23, 9, 1, -17, 1},   // 0x7B '{'
+    {2651, 2, 22, 7, 2, -17, 1},   // 0x7C '|'
+    {2673, 6, 23, 9, 3, -17, 1},   // 0x7D '}'
+    {2696, 12, 5, 12, 0, -7, 1},   // 0x7E '~'
+};
+
+inline constexpr Font FreeSansBold12pt7b = {
+    FreeSansBold12pt7bBitmaps, FreeSansBold12pt7bGlyphs, 0x20, 0x7E, 29, 17, 6};
+
+// FreeSansBold18pt7b.h: 95 glyphs from 0x20 to 0x7E, 5645 bitmap bytes
+inline constexpr uint8_t FreeSansBold18pt7bBitmaps[] = {
+    0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0x70, 0x70, 0x70, 0x70, 0x70,
+    0x70, 0x70, 0x00, 0x00, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8,
+    0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x03, 0xc3, 0x80, 0x03, 0xc7,
+    0x80, 0x03, 0xc7, 0x80, 0x03, 0x87, 0x80, 0x07, 0x87, 0x00, 0x7f, 0xff, 0xf0, 0x7f, 0xff, 0xf0,
+    0x7f, 0xff, 0xf0, 0x7f, 0xff, 0xf0, 0x0f, 0x0e, 0x00, 0x0f, 0x0e, 0x00, 0x0f, 0x1e, 0x00, 0x0f,
+    0x1e, 0x00, 0x0e, 0x1e, 0x00, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xc0, 0xff, 0xff,
+    0xc0, 0x1c, 0x3c, 0x00, 0x3c, 0x38, 0x00, 0x3c, 0x78, 0x00, 0x3c, 0x78, 0x00, 0x38, 0x78, 0x00,
+    0x38, 0x78, 0x00, 0x00, 0x60, 0x00, 0x03, 0xfc, 0x00, 0x0f, 0xff, 0x00, 0x1f, 0xff, 0x80, 0x3f,
+    0xff, 0xc0, 0x7e, 0x6f, 0xc0, 0x7c, 0x67, 0xe0, 0x78, 0x63, 0xe0, 0x78, 0x63, 0xe0, 0x7c, 0x60,
+    0x00, 0x7f, 0x60, 0x00, 0x3f, 0xe0, 0x00, 0x1f, 0xfc, 0x00, 0x0f, 0xff, 0x00, 0x01, 0xff, 0x80,
+    0x00, 0x7f, 0xc0, 0x00, 0x67, 0xe0, 0x00, 0x63, 0xe0, 0xf8, 0x63, 0xe0, 0xf8, 0x63, 0xe0, 0xfc,
+    0x63, 0xe0, 0x7e, 0x6f, 0xc0, 0x7f, 0xff, 0xc0, 0x3f, 0xff, 0x80, 0x0f, 0xff, 0x00, 0x03, 0xfc,
+    0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x0f, 0x00, 0x1c, 0x00, 0x3f, 0xc0,
+    0x1c, 0x00, 0x7f, 0xe0, 0x38, 0x00, 0x7f, 0xe0, 0x38, 0x00, 0xf0, 0xf0, 0x70, 0x00, 0xe0, 0x70,
+    0x70, 0x00, 0xe0, 0x70, 0xe0, 0x00, 0xe0, 0x71, 0xe0, 0x00, 0xf0, 0xf1, 0xc0, 0x00, 0x7f, 0xe3,
+    0x80, 0x00, 0x7f, 0xe3, 0x80, 0x00, 0x3f, 0xc7, 0x00, 0x00, 0x0f, 0x07, 0x0f, 0x80, 0x00, 0x0e,
+    0x3f, 0xe0, 0x00, 0x0e, 0x7f, 0xf0, 0x00, 0x1c, 0x7f, 0xf0, 0x00, 0x1c, 0xf0, 0x78, 0x00, 0x38,
+    0xe0, 0x38, 0x00, 0x30, 0xe0, 0x38, 0x00, 0x70, 0xe0, 0x38, 0x00, 0x60, 0xf0, 0x78, 0x00, 0xe0,
+    0x7f, 0xf0, 0x01, 0xc0, 0x7f, 0xf0, 0x01, 0xc0, 0x3f, 0xe0, 0x03, 0x80, 0x0f, 0x80, 0x01, 0xf0,
+    0x00, 0x07, 0xf8, 0x00, 0x0f, 0xfc, 0x00, 0x0f, 0xfe, 0x00, 0x1f, 0x1e, 0x00, 0x1f, 0x1e, 0x00,
+    0x1f, 0x1e, 0x00, 0x1f, 0x9e, 0x00, 0x0f, 0xbc, 0x00, 0x07, 0xf8, 0x00, 0x03, 0xf0, 0x00, 0x07,
+    0xe0, 0x00, 0x1f, 0xf0, 0xf0, 0x3f, 0xf8, 0xf0, 0x7e, 0x7c, 0xf0, 0xfc, 0x3f, 0xe0, 0xf8, 0x3f,
+    0xe0, 0xf8, 0x1f, 0xe0, 0xf8, 0x0f, 0xc0, 0xfc, 0x0f, 0xc0, 0x7e, 0x3f, 0xe0, 0x7f, 0xff, 0xe0,
+    0x3f, 0xff, 0xf0, 0x1f, 0xf9, 0xf8, 0x07, 0xf0, 0xfc, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0x70,
+    0x70, 0x70, 0x07, 0x80, 0x0f, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x3c, 0x00, 0x3c, 0x00,
+    0x3c, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00,
+    0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0x70, 0x00, 0x78, 0x00,
+    0x78, 0x00, 0x78, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x1c, 0x00, 0x1e, 0x00, 0x0e, 0x00, 0x0f, 0x00,
+    0x07, 0x00, 0x07, 0x80, 0xf0, 0x00, 0x70, 0x00, 0x78, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x1e, 0x00,
+    0x1e, 0x00, 0x1e, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80,
+    0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x07, 0x80, 0x0f, 0x00,
+    0x0f, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x38, 0x00,
+    0x78, 0x00, 0x70, 0x00, 0xf0, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x76, 0xe0, 0x7f, 0xe0,
+    0x3f, 0xc0, 0x0f, 0x00, 0x1f, 0x80, 0x1f, 0x80, 0x39, 0xc0, 0x10, 0x80, 0x03, 0xc0, 0x03, 0xc0,
+    0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0xf8, 0xf8, 0xf8, 0xf8,
+    0xf8, 0x18, 0x18, 0x18, 0x30, 0xf0, 0xc0, 0xff, 0x80, 0xff, 0x80, 0xff, 0x80, 0xff, 0x80, 0xf8,
+    0xf8, 0xf8, 0xf8, 0xf8, 0x01, 0x80, 0x03, 0x80, 0x03, 0x00, 0x03, 0x00, 0x07, 0x00, 0x07, 0x00,
+    0x06, 0x00, 0x06, 0x00, 0x0e, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x1c, 0x00, 0x18, 0x00,
+    0x18, 0x00, 0x18, 0x00, 0x38, 0x00, 0x30, 0x00, 0x30, 0x00, 0x70, 0x00, 0x70, 0x00, 0x60, 0x00,
+    0x60, 0x00, 0xe0, 0x00, 0xc0, 0x00, 0x07, 0xf0, 0x00, 0x1f, 0xfc, 0x00, 0x3f, 0xfe, 0x00, 0x3f,
+    0xfe, 0x00, 0x7e, 0x3f, 0x00, 0x7c, 0x1f, 0x00, 0x7c, 0x1f, 0x00, 0xf8, 0x0f, 0x80, 0xf8, 0x0f,
+    0x80, 0xf8, 0x0f, 0x80, 0xf8, 0x0f, 0x80, 0xf8, 0x0f, 0x80, 0xf8, 0x0f, 0x80, 0xf8, 0x0f, 0x80,
+    0xf8, 0x0f, 0x80, 0xf8, 0x0f, 0x80, 0xf8, 0x0f, 0x80, 0xf8, 0x0f, 0x80, 0x7c, 0x1f, 0x00, 0x7c,
+    0x1f, 0x00, 0x7e, 0x3f, 0x00, 0x3f, 0xfe, 0x00, 0x3f, 0xfe, 0x00, 0x1f, 0xfc, 0x00, 0x07, 0xf0,
+    0x00, 0x01, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x07, 0xc0, 0x1f, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff,
+    0xc0, 0x07, 0xc0, 0x07, 0xc0, 0x07, 0xc0, 0x07, 0xc0, 0x07, 0xc0, 0x07, 0xc0, 0x07, 0xc0, 0x07,
+    0xc0, 0x07, 0xc0, 0x07, 0xc0, 0x07, 0xc0, 0x07, 0xc0, 0x07, 0xc0, 0x07, 0xc0, 0x07, 0xc0, 0x07,
+    0xc0, 0x07, 0xc0, 0x07, 0xf0, 0x00, 0x1f, 0xfc, 0x00, 0x3f, 0xfe, 0x00, 0x7f, 0xff, 0x00, 0x7e,
+    0x3f, 0x00, 0xfc, 0x1f, 0x80, 0xf8, 0x0f, 0x80, 0xf8, 0x0f, 0x80, 0xf8, 0x0f, 0x80, 0x00, 0x0f,
+    0x80, 0x00, 0x1f, 0x80, 0x00, 0x1f, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x7e, 0x00, 0x01, 0xfc, 0x00,
+    0x03, 0xf8, 0x00, 0x07, 0xe0, 0x00, 0x0f, 0xc0, 0x00, 0x1f, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x3e,
+    0x00, 0x00, 0x7f, 0xff, 0x80, 0x7f, 0xff, 0x80, 0x7f, 0xff, 0x80, 0x7f, 0xff, 0x80, 0x07, 0xe0,
+    0x00, 0x1f, 0xf8, 0x00, 0x3f, 0xfc, 0x00, 0x7f, 0xfe, 0x00, 0xfc, 0x3f, 0x00, 0xf8, 0x1f, 0x00,
+    0xf8, 0x1f, 0x00, 0xf8, 0x1f, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x3e, 0x00, 0x01,
+    0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x0f,
+    0x80, 0xf8, 0x0f, 0x80, 0xf8, 0x0f, 0x80, 0xfc, 0x1f, 0x80, 0x7c, 0x3f, 0x00, 0x7f, 0xff, 0x00,
+    0x3f, 0xfe, 0x00, 0x1f, 0xfc, 0x00, 0x07, 0xf0, 0x00, 0x00, 0xfc, 0x00, 0xfc, 0x01, 0xfc, 0x01,
+    0xfc, 0x03, 0xfc, 0x07, 0x7c, 0x07, 0x7c, 0x0e, 0x7c, 0x0e, 0x7c, 0x1c, 0x7c, 0x18, 0x7c, 0x38,
+    0x7c, 0x70, 0x7c, 0x60, 0x7c, 0xe0, 0x7c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
+    0x7c, 0x00, 0x7c, 0x00, 0x7c, 0x00, 0x7c, 0x00, 0x7c, 0x00, 0x7c, 0x1f, 0xff, 0x00, 0x1f, 0xff,
+    0x00, 0x3f, 0xff, 0x00, 0x3f, 0xff, 0x00, 0x3c, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x38, 0x00, 0x00,
+    0x38, 0x00, 0x00, 0x79, 0xf0, 0x00, 0x7f, 0xfc, 0x00, 0x7f, 0xfe, 0x00, 0x7f, 0xff, 0x00, 0x7c,
+    0x3f, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x0f, 0x80, 0x00, 0x0f, 0x80, 0x00, 0x0f, 0x80, 0x00, 0x0f,
+    0x80, 0xf8, 0x0f, 0x80, 0xf8, 0x1f, 0x80, 0xfc, 0x3f, 0x00, 0x7f, 0xfe, 0x00, 0x7f, 0xfe, 0x00,
+    0x1f, 0xf8, 0x00, 0x07, 0xe0, 0x00, 0x03, 0xf8, 0x00, 0x0f, 0xfe, 0x00, 0x1f, 0xff, 0x00, 0x3f,
+    0xff, 0x80, 0x3e, 0x1f, 0x80, 0x7c, 0x0f, 0x80, 0x7c, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0xf8,
+    0x00, 0xfb, 0xfe, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x80, 0xfe, 0x1f, 0x80, 0xfc, 0x0f, 0xc0,
+    0xf8, 0x07, 0xc0, 0xf8, 0x07, 0xc0, 0xf8, 0x07, 0xc0, 0xf8, 0x07, 0xc0, 0x78, 0x07, 0xc0, 0x7c,
+    0x0f, 0x80, 0x7e, 0x1f, 0x80, 0x3f, 0xff, 0x00, 0x1f, 0xff, 0x00, 0x0f, 0xfc, 0x00, 0x03, 0xf0,
+    0x00, 0xff, 0xff, 0x80, 0xff, 0xff, 0x80, 0xff, 0xff, 0x80, 0xff, 0xff, 0x80, 0x00, 0x0f, 0x00,
+    0x00, 0x1f, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x78, 0x00, 0x00,
+    0xf8, 0x00, 0x00, 0xf0, 0x00, 0x01, 0xf0, 0x00, 0x01, 0xe0, 0x00, 0x03, 0xe0, 0x00, 0x03, 0xe0,
+    0x00, 0x03, 0xc0, 0x00, 0x07, 0xc0, 0x00, 0x07, 0xc0, 0x00, 0x07, 0xc0, 0x00, 0x07, 0x80, 0x00,
+    0x0f, 0x80, 0x00, 0x0f, 0x80, 0x00, 0x0f, 0x80, 0x00, 0x0f, 0x80, 0x00, 0x07, 0xe0, 0x00, 0x0f,
+    0xf8, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xfe, 0x00, 0x7c, 0x3f, 0x00, 0x78, 0x1f, 0x00, 0x78, 0x0f,
+    0x00, 0x78, 0x0f, 0x00, 0x78, 0x1f, 0x00, 0x3c, 0x3e, 0x00, 0x1f, 0xfc, 0x00, 0x0f, 0xf8, 0x00,
+    0x3f, 0xfe, 0x00, 0x7e, 0x3f, 0x00, 0x7c, 0x1f, 0x00, 0xf8, 0x0f, 0x80, 0xf8, 0x0f, 0x80, 0xf8,
+    0x0f, 0x80, 0xf8, 0x0f, 0x80, 0xfc, 0x1f, 0x80, 0x7c, 0x3f, 0x00, 0x7f, 0xff, 0x00, 0x3f, 0xfe,
+    0x00, 0x1f, 0xfc, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xe0, 0x00, 0x1f, 0xf8, 0x00, 0x3f, 0xfc, 0x00,
+    0x7f, 0xfe, 0x00, 0x7e, 0x3f, 0x00, 0xfc, 0x1f, 0x00, 0xf8, 0x0f, 0x00, 0xf8, 0x0f, 0x80, 0xf8,
+    0x0f, 0x80, 0xf8, 0x0f, 0x80, 0xf8, 0x0f, 0x80, 0xfc, 0x1f, 0x80, 0x7e, 0x3f, 0x80, 0x7f, 0xff,
+    0x80, 0x3f, 0xff, 0x80, 0x1f, 0xef, 0x80, 0x07, 0xcf, 0x80, 0x00, 0x0f, 0x00, 0x00, 0x0f, 0x00,
+    0xf8, 0x1f, 0x00, 0x7c, 0x3e, 0x00, 0x7f, 0xfe, 0x00, 0x3f, 0xfc, 0x00, 0x1f, 0xf8, 0x00, 0x07,
+    0xe0, 0x00, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8,
+    0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0x18, 0x18, 0x38, 0x30, 0xf0, 0xc0, 0x00, 0x00, 0xc0, 0x00,
+    0x03, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0xff, 0xc0, 0x03, 0xff, 0x00, 0x1f, 0xf8, 0x00, 0xff, 0xc0,
+    0x00, 0xfe, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xff, 0xc0, 0x00, 0x1f, 0xf8, 0x00,
+    0x07, 0xff, 0x00, 0x00, 0xff, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x07, 0xc0, 0x00, 0x00, 0xc0, 0xff,
+    0xff, 0x80, 0xff, 0xff, 0x80, 0xff, 0xff, 0x80, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x80, 0xff, 0xff, 0x80, 0xff, 0xff, 0x80,
+    0xff, 0xff, 0x80, 0xc0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xff, 0xc0, 0x00, 0x3f,
+    0xf0, 0x00, 0x07, 0xfe, 0x00, 0x00, 0xff, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x03, 0xc0, 0x00, 0x1f,
+    0xc0, 0x00, 0xff, 0xc0, 0x07, 0xfe, 0x00, 0x3f, 0xf8, 0x00, 0xff, 0xc0, 0x00, 0xfe, 0x00, 0x00,
+    0xf0, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x07, 0xf0, 0x00, 0x1f, 0xfc, 0x00, 0x3f, 0xff, 0x00, 0x7f,
+    0xff, 0x00, 0x7e, 0x3f, 0x80, 0xfc, 0x0f, 0xc0, 0xf8, 0x07, 0xc0, 0xf8, 0x07, 0xc0, 0xf8, 0x07,
+    0xc0, 0x00, 0x0f, 0xc0, 0x00, 0x1f, 0xc0, 0x00, 0x3f, 0x80, 0x00, 0x7f, 0x00, 0x00, 0xfe, 0x00,
+    0x01, 0xfc, 0x00, 0x01, 0xf0, 0x00, 0x03, 0xe0, 0x00, 0x03, 0xc0, 0x00, 0x03, 0xc0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xe0, 0x00, 0x03, 0xe0, 0x00, 0x03, 0xe0, 0x00, 0x03, 0xe0,
+    0x00, 0x03, 0xe0, 0x00, 0x00, 0x07, 0xfc, 0x00, 0x00, 0x3f, 0xff, 0x00, 0x00, 0xff, 0xff, 0xc0,
+    0x01, 0xf8, 0x07, 0xf0, 0x03, 0xe0, 0x01, 0xf8, 0x07, 0x80, 0x00, 0x7c, 0x0f, 0x00, 0x00, 0x3c,
+    0x1e, 0x03, 0xe3, 0x9e, 0x3c, 0x0f, 0xf7, 0x8e, 0x38, 0x1f, 0xff, 0x0e, 0x78, 0x3e, 0x1f, 0x07,
+    0x70, 0x38, 0x0f, 0x07, 0x70, 0x78, 0x0f, 0x07, 0xe0, 0x70, 0x0e, 0x07, 0xe0, 0x70, 0x0e, 0x07,
+    0xe0, 0xe0, 0x0e, 0x07, 0xe0, 0xe0, 0x1e, 0x0f, 0xe0, 0xe0, 0x1c, 0x0e, 0xe0, 0xe0, 0x3c, 0x1e,
+    0xe0, 0xf0, 0x3c, 0x3c, 0xf0, 0xf0, 0xfc, 0x7c, 0x70, 0x7f, 0xff, 0xf8, 0x78, 0x3f, 0xcf, 0xf0,
+    0x3c, 0x1f, 0x07, 0xc0, 0x3e, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x0f, 0xc0, 0x01, 0x00,
+    0x07, 0xf0, 0x0f, 0x00, 0x03, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x1f, 0xf8, 0x00,
+    0x00, 0x7e, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x80, 0x01,
+    0xff, 0x80, 0x01, 0xff, 0x80, 0x01, 0xf7, 0xc0, 0x03, 0xe7, 0xc0, 0x03, 0xe7, 0xc0, 0x03, 0xe3,
+    0xe0, 0x07, 0xc3, 0xe0, 0x07, 0xc3, 0xe0, 0x07, 0xc1, 0xf0, 0x0f, 0x81, 0xf0, 0x0f, 0x81, 0xf0,
+    0x0f, 0xff, 0xf8, 0x1f, 0xff, 0xf8, 0x1f, 0xff, 0xfc, 0x1f, 0xff, 0xfc, 0x3e, 0x00, 0x7c, 0x3e,
+    0x00, 0x7e, 0x3e, 0x00, 0x3e, 0x7c, 0x00, 0x3e, 0x7c, 0x00, 0x3f, 0x7c, 0x00, 0x1f, 0xff, 0xfc,
+    0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x80, 0xff, 0xff, 0xc0, 0xf8, 0x07, 0xe0, 0xf8, 0x03, 0xe0,
+    0xf8, 0x03, 0xe0, 0xf8, 0x03, 0xe0, 0xf8, 0x03, 0xe0, 0xf8, 0x03, 0xe0, 0xf8, 0x07, 0xc0, 0xff,
+    0xff, 0x80, 0xff, 0xff, 0x00, 0xff, 0xff, 0x80, 0xff, 0xff, 0xc0, 0xf8, 0x07, 0xe0, 0xf8, 0x01,
+    0xe0, 0xf8, 0x01, 0xf0, 0xf8, 0x01, 0xf0, 0xf8, 0x01, 0xf0, 0xf8, 0x01, 0xf0, 0xf8, 0x03, 0xe0,
+    0xff, 0xff, 0xe0, 0xff, 0xff, 0xc0, 0xff, 0xff, 0x80, 0xff, 0xfe, 0x00, 0x00, 0xff, 0x00, 0x03,
+    0xff, 0xc0, 0x0f, 0xff, 0xf0, 0x1f, 0xff, 0xf8, 0x3f, 0x81, 0xf8, 0x3f, 0x00, 0xfc, 0x7e, 0x00,
+    0x7c, 0x7c, 0x00, 0x3e, 0x7c, 0x00, 0x3e, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00,
+    0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x7c,
+    0x00, 0x3e, 0x7c, 0x00, 0x3e, 0x7e, 0x00, 0x7e, 0x3f, 0x00, 0xfc, 0x3f, 0x81, 0xfc, 0x1f, 0xff,
+    0xf8, 0x0f, 0xff, 0xf0, 0x03, 0xff, 0xc0, 0x00, 0xff, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0x80, 0xff, 0xff, 0xc0, 0xf8, 0x0f, 0xe0, 0xf8, 0x03, 0xe0, 0xf8, 0x01, 0xf0, 0xf8,
+    0x01, 0xf0, 0xf8, 0x01, 0xf0, 0xf8, 0x00, 0xf8, 0xf8, 0x00, 0xf8, 0xf8, 0x00, 0xf8, 0xf8, 0x00,
+    0xf8, 0xf8, 0x00, 0xf8, 0xf8, 0x00, 0xf8, 0xf8, 0x00, 0xf8, 0xf8, 0x00, 0xf8, 0xf8, 0x01, 0xf8,
+    0xf8, 0x01, 0xf0, 0xf8, 0x01, 0xf0, 0xf8, 0x03, 0xe0, 0xf8, 0x0f, 0xe0, 0xff, 0xff, 0xc0, 0xff,
+    0xff, 0x80, 0xff, 0xff, 0x00, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xc0, 0xff, 0xff,
+    0xc0, 0xff, 0xff, 0xc0, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00,
+    0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0xff, 0x80, 0xff, 0xff, 0x80, 0xff,
+    0xff, 0x80, 0xff, 0xff, 0x80, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00,
+    0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xe0,
+    0xff, 0xff, 0xe0, 0xff, 0xff, 0xe0, 0xff, 0xff, 0x80, 0xff, 0xff, 0x80, 0xff, 0xff, 0x80, 0xff,
+    0xff, 0x80, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00,
+    0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00,
+    0xff, 0xff, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8,
+    0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00,
+    0x00, 0xf8, 0x00, 0x00, 0x00, 0x7f, 0x80, 0x03, 0xff, 0xe0, 0x07, 0xff, 0xf8, 0x0f, 0xff, 0xfc,
+    0x1f, 0xc0, 0xfe, 0x3f, 0x00, 0x7e, 0x7e, 0x00, 0x3f, 0x7c, 0x00, 0x1f, 0x7c, 0x00, 0x00, 0xf8,
+    0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x03, 0xff, 0xf8, 0x03, 0xff, 0xf8, 0x03,
+    0xff, 0xf8, 0x03, 0xff, 0xfc, 0x00, 0x0f, 0x7c, 0x00, 0x1f, 0x7c, 0x00, 0x1f, 0x7e, 0x00, 0x3f,
+    0x3f, 0x00, 0x7f, 0x1f, 0xc1, 0xff, 0x0f, 0xff, 0xff, 0x07, 0xff, 0xe7, 0x03, 0xff, 0xc7, 0x00,
+    0xff, 0x07, 0xf8, 0x01, 0xf0, 0xf8, 0x01, 0xf0, 0xf8, 0x01, 0xf0, 0xf8, 0x01, 0xf0, 0xf8, 0x01,
+    0xf0, 0xf8, 0x01, 0xf0, 0xf8, 0x01, 0xf0, 0xf8, 0x01, 0xf0, 0xf8, 0x01, 0xf0, 0xf8, 0x01, 0xf0,
+    0xff, 0xff, 0xf0, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xf0, 0xf8, 0x01, 0xf0, 0xf8,
+    0x01, 0xf0, 0xf8, 0x01, 0xf0, 0xf8, 0x01, 0xf0, 0xf8, 0x01, 0xf0, 0xf8, 0x01, 0xf0, 0xf8, 0x01,
+    0xf0, 0xf8, 0x01, 0xf0, 0xf8, 0x01, 0xf0, 0xf8, 0x01, 0xf0, 0xf8, 0x01, 0xf0, 0xf8, 0x01, 0xf0,
+    0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8,
+    0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f,
+    0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f,
+    0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x1f, 0xf8, 0x1f, 0xf8, 0x1f, 0xf8, 0x1f,
+    0xf8, 0x1f, 0xf8, 0x1f, 0xfc, 0x3f, 0x7f, 0xfe, 0x3f, 0xfc, 0x1f, 0xf8, 0x07, 0xe0, 0xf8, 0x01,
+    0xf8, 0xf8, 0x03, 0xf0, 0xf8, 0x07, 0xe0, 0xf8, 0x0f, 0xc0, 0xf8, 0x1f, 0x80, 0xf8, 0x3f, 0x00,
+    0xf8, 0x7e, 0x00, 0xf8, 0xfc, 0x00, 0xf8, 0xf8, 0x00, 0xf9, 0xf8, 0x00, 0xfb, 0xf0, 0x00, 0xff,
+    0xe0, 0x00, 0xff, 0xf0, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xfe, 0xfc, 0x00, 0xfc, 0x7e,
+    0x00, 0xf8, 0x3f, 0x00, 0xf8, 0x1f, 0x80, 0xf8, 0x1f, 0x80, 0xf8, 0x0f, 0xc0, 0xf8, 0x07, 0xe0,
+    0xf8, 0x07, 0xf0, 0xf8, 0x03, 0xf0, 0xf8, 0x01, 0xf8, 0xf8, 0x00, 0xfc, 0xf8, 0x00, 0x00, 0xf8,
+    0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00,
+    0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00,
+    0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8,
+    0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xff, 0xff,
+    0x80, 0xff, 0xff, 0x80, 0xff, 0xff, 0x80, 0xff, 0xff, 0x80, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff,
+    0xff, 0x00, 0xff, 0xff, 0x01, 0xff, 0xff, 0x81, 0xff, 0xff, 0x81, 0xff, 0xff, 0x81, 0xff, 0xff,
+    0x81, 0xff, 0xfb, 0xc3, 0xdf, 0xfb, 0xc3, 0xdf, 0xfb, 0xc3, 0xdf, 0xfb, 0xc3, 0xdf, 0xf9, 0xc7,
+    0xdf, 0xf9, 0xe7, 0x9f, 0xf9, 0xe7, 0x9f, 0xf9, 0xe7, 0x9f, 0xf9, 0xe7, 0x9f, 0xf8, 0xff, 0x1f,
+    0xf8, 0xff, 0x1f, 0xf8, 0xff, 0x1f, 0xf8, 0xff, 0x1f, 0xf8, 0x7f, 0x1f, 0xf8, 0x7e, 0x1f, 0xf8,
+    0x7e, 0x1f, 0xf8, 0x7e, 0x1f, 0xf8, 0x3e, 0x1f, 0xf8, 0x01, 0xf0, 0xfc, 0x01, 0xf0, 0xfe, 0x01,
+    0xf0, 0xfe, 0x01, 0xf0, 0xff, 0x01, 0xf0, 0xff, 0x01, 0xf0, 0xff, 0x81, 0xf0, 0xff, 0x81, 0xf0,
+    0xff, 0xc1, 0xf0, 0xfb, 0xc1, 0xf0, 0xfb, 0xe1, 0xf0, 0xf9, 0xf1, 0xf0, 0xf9, 0xf1, 0xf0, 0xf8,
+    0xf9, 0xf0, 0xf8, 0x79, 0xf0, 0xf8, 0x7d, 0xf0, 0xf8, 0x3d, 0xf0, 0xf8, 0x3f, 0xf0, 0xf8, 0x1f,
+    0xf0, 0xf8, 0x1f, 0xf0, 0xf8, 0x0f, 0xf0, 0xf8, 0x0f, 0xf0, 0xf8, 0x07, 0xf0, 0xf8, 0x03, 0xf0,
+    0xf8, 0x03, 0xf0, 0xf8, 0x01, 0xf0, 0x00, 0x7f, 0x00, 0x00, 0x03, 0xff, 0xe0, 0x00, 0x07, 0xff,
+    0xf0, 0x00, 0x1f, 0xff, 0xf8, 0x00, 0x1f, 0xc1, 0xfc, 0x00, 0x3f, 0x00, 0x7e, 0x00, 0x7e, 0x00,
+    0x3f, 0x00, 0x7c, 0x00, 0x1f, 0x00, 0x7c, 0x00, 0x1f, 0x00, 0xf8, 0x00, 0x0f, 0x80, 0xf8, 0x00,
+    0x0f, 0x80, 0xf8, 0x00, 0x0f, 0x80, 0xf8, 0x00, 0x0f, 0x80, 0xf8, 0x00, 0x0f, 0x80, 0xf8, 0x00,
+    0x0f, 0x80, 0xf8, 0x00, 0x0f, 0x80, 0xf8, 0x00, 0x0f, 0x80, 0x7c, 0x00, 0x1f, 0x00, 0x7c, 0x00,
+    0x1f, 0x00, 0x7e, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x7e, 0x00, 0x1f, 0xc1, 0xfc, 0x00, 0x1f, 0xff,
+    0xf8, 0x00, 0x07, 0xff, 0xf0, 0x00, 0x03, 0xff, 0xe0, 0x00, 0x00, 0x7f, 0x00, 0x00, 0xff, 0xfc,
+    0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x80, 0xff, 0xff, 0xc0, 0xf8, 0x0f, 0xe0, 0xf8, 0x07, 0xe0,
+    0xf8, 0x03, 0xe0, 0xf8, 0x03, 0xe0, 0xf8, 0x03, 0xe0, 0xf8, 0x03, 0xe0, 0xf8, 0x07, 0xe0, 0xf8,
+    0x0f, 0xc0, 0xff, 0xff, 0xc0, 0xff, 0xff, 0x80, 0xff, 0xff, 0x00, 0xff, 0xfc, 0x00, 0xf8, 0x00,
+    0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00,
+    0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00,
+    0x03, 0xff, 0xe0, 0x00, 0x07, 0xff, 0xf0, 0x00, 0x1f, 0xff, 0xf8, 0x00, 0x1f, 0xc1, 0xfc, 0x00,
+    0x3f, 0x00, 0x7e, 0x00, 0x7e, 0x00, 0x3f, 0x00, 0x7c, 0x00, 0x1f, 0x00, 0x7c, 0x00, 0x1f, 0x00,
+    0xf8, 0x00, 0x0f, 0x80, 0xf8, 0x00, 0x0f, 0x80, 0xf8, 0x00, 0x0f, 0x80, 0xf8, 0x00, 0x0f, 0x80,
+    0xf8, 0x00, 0x0f, 0x80, 0xf8, 0x00, 0x0f, 0x80, 0xf8, 0x00, 0x0f, 0x80, 0xf8, 0x01, 0x0f, 0x80,
+    0x7c, 0x03, 0x9f, 0x00, 0x7c, 0x07, 0xff, 0x00, 0x7e, 0x03, 0xff, 0x00, 0x3f, 0x01, 0xfe, 0x00,
+    0x1f, 0xc1, 0xfe, 0x00, 0x1f, 0xff, 0xfe, 0x00, 0x07, 0xff, 0xff, 0x00, 0x03, 0xff, 0xef, 0x80,
+    0x00, 0x7f, 0x87, 0x00, 0x00, 0x00, 0x02, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0xc0, 0xff, 0xff,
+    0xe0, 0xff, 0xff, 0xe0, 0xf8, 0x03, 0xf0, 0xf8, 0x01, 0xf0, 0xf8, 0x01, 0xf0, 0xf8, 0x01, 0xf0,
+    0xf8, 0x01, 0xf0, 0xf8, 0x01, 0xe0, 0xf8, 0x03, 0xe0, 0xff, 0xff, 0xc0, 0xff, 0xff, 0x80, 0xff,
+    0xff, 0x80, 0xff, 0xff, 0xc0, 0xf8, 0x07, 0xe0, 0xf8, 0x03, 0xe0, 0xf8, 0x03, 0xe0, 0xf8, 0x03,
+    0xe0, 0xf8, 0x03, 0xe0, 0xf8, 0x03, 0xe0, 0xf8, 0x03, 0xe0, 0xf8, 0x03, 0xe0, 0xf8, 0x03, 0xe0,
+    0xf8, 0x03, 0xf0, 0xf8, 0x01, 0xf8, 0x07, 0xf8, 0x00, 0x1f, 0xff, 0x00, 0x3f, 0xff, 0x80, 0x7f,
+    0xff, 0xc0, 0x7e, 0x0f, 0xc0, 0xfc, 0x07, 0xe0, 0xf8, 0x03, 0xe0, 0xf8, 0x03, 0xe0, 0xf8, 0x00,
+    0x00, 0xfc, 0x00, 0x00, 0xff, 0x00, 0x00, 0x7f, 0xfc, 0x00, 0x3f, 0xff, 0x80, 0x1f, 0xff, 0xc0,
+    0x03, 0xff, 0xe0, 0x00, 0x1f, 0xf0, 0x00, 0x03, 0xf0, 0x00, 0x01, 0xf0, 0xf8, 0x01, 0xf0, 0xf8,
+    0x01, 0xf0, 0xfc, 0x03, 0xf0, 0xfe, 0x07, 0xe0, 0x7f, 0xff, 0xe0, 0x3f, 0xff, 0xc0, 0x1f, 0xff,
+    0x00, 0x03, 0xfc, 0x00, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xe0,
+    0x01, 0xf0, 0x00, 0x01, 0xf0, 0x00, 0x01, 0xf0, 0x00, 0x01, 0xf0, 0x00, 0x01, 0xf0, 0x00, 0x01,
+    0xf0, 0x00, 0x01, 0xf0, 0x00, 0x01, 0xf0, 0x00, 0x01, 0xf0, 0x00, 0x01, 0xf0, 0x00, 0x01, 0xf0,
+    0x00, 0x01, 0xf0, 0x00, 0x01, 0xf0, 0x00, 0x01, 0xf0, 0x00, 0x01, 0xf0, 0x00, 0x01, 0xf0, 0x00,
+    0x01, 0xf0, 0x00, 0x01, 0xf0, 0x00, 0x01, 0xf0, 0x00, 0x01, 0xf0, 0x00, 0x01, 0xf0, 0x00, 0x01,
+    0xf0, 0x00, 0xf8, 0x01, 0xf0, 0xf8, 0x01, 0xf0, 0xf8, 0x01, 0xf0, 0xf8, 0x01, 0xf0, 0xf8, 0x01,
+    0xf0, 0xf8, 0x01, 0xf0, 0xf8, 0x01, 0xf0, 0xf8, 0x01, 0xf0, 0xf8, 0x01, 0xf0, 0xf8, 0x01, 0xf0,
+    0xf8, 0x01, 0xf0, 0xf8, 0x01, 0xf0, 0xf8, 0x01, 0xf0, 0xf8, 0x01, 0xf0, 0xf8, 0x01, 0xf0, 0xf8,
+    0x01, 0xf0, 0xf8, 0x01, 0xf0, 0xf8, 0x01, 0xf0, 0xf8, 0x01, 0xf0, 0xf8, 0x01, 0xf0, 0x7c, 0x03,
+    0xe0, 0x7e, 0x07, 0xe0, 0x3f, 0xff, 0xc0, 0x3f, 0xff, 0xc0, 0x0f, 0xff, 0x00, 0x03, 0xfc, 0x00,
+    0xf8, 0x00, 0xf8, 0xf8, 0x00, 0xf8, 0x7c, 0x01, 0xf8, 0x7c, 0x01, 0xf0, 0x7c, 0x01, 0xf0, 0x3e,
+    0x01, 0xf0, 0x3e, 0x03, 0xe0, 0x3e, 0x03, 0xe0, 0x1e, 0x03, 0xe0, 0x1f, 0x07, 0xc0, 0x1f, 0x07,
+    0xc0, 0x0f, 0x07, 0xc0, 0x0f, 0x87, 0x80, 0x0f, 0x8f, 0x80, 0x0f, 0x8f, 0x80, 0x07, 0x8f, 0x00,
+    0x07, 0xcf, 0x00, 0x07, 0xdf, 0x00, 0x03, 0xde, 0x00, 0x03, 0xfe, 0x00, 0x03, 0xfe, 0x00, 0x01,
+    0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0xf8, 0x07,
+    0xc0, 0x3f, 0xf8, 0x07, 0xe0, 0x3e, 0xfc, 0x07, 0xe0, 0x3e, 0x7c, 0x0f, 0xe0, 0x3e, 0x7c, 0x0f,
+    0xe0, 0x7e, 0x7c, 0x0f, 0xe0, 0x7c, 0x7c, 0x0f, 0xf0, 0x7c, 0x3e, 0x0f, 0xf0, 0x7c, 0x3e, 0x1e,
+    0xf0, 0x78, 0x3e, 0x1e, 0x70, 0xf8, 0x1e, 0x1e, 0x70, 0xf8, 0x1e, 0x1e, 0x78, 0xf8, 0x1f, 0x1e,
+    0x78, 0xf0, 0x1f, 0x3c, 0x78, 0xf0, 0x0f, 0x3c, 0x39, 0xf0, 0x0f, 0x3c, 0x3d, 0xf0, 0x0f, 0x3c,
+    0x3d, 0xe0, 0x0f, 0xbc, 0x3d, 0xe0, 0x07, 0xf8, 0x3d, 0xe0, 0x07, 0xf8, 0x1f, 0xe0, 0x07, 0xf8,
+    0x1f, 0xc0, 0x03, 0xf8, 0x1f, 0xc0, 0x03, 0xf8, 0x1f, 0xc0, 0x03, 0xf0, 0x0f, 0x80, 0x03, 0xf0,
+    0x0f, 0x80, 0x01, 0xf0, 0x0f, 0x80, 0xfe, 0x01, 0xf8, 0x7e, 0x01, 0xf8, 0x3f, 0x03, 0xf0, 0x3f,
+    0x03, 0xe0, 0x1f, 0x87, 0xe0, 0x1f, 0x8f, 0xc0, 0x0f, 0xcf, 0xc0, 0x07, 0xdf, 0x80, 0x07, 0xff,
+    0x00, 0x03, 0xff, 0x00, 0x03, 0xfe, 0x00, 0x01, 0xfc, 0x00, 0x00, 0xfc, 0x00, 0x01, 0xfc, 0x00,
+    0x01, 0xfe, 0x00, 0x03, 0xfe, 0x00, 0x03, 0xff, 0x00, 0x07, 0xdf, 0x80, 0x0f, 0xcf, 0x80, 0x0f,
+    0x8f, 0xc0, 0x1f, 0x87, 0xc0, 0x1f, 0x07, 0xe0, 0x3f, 0x03, 0xf0, 0x7e, 0x03, 0xf0, 0x7e, 0x01,
+    0xf8, 0xfc, 0x01, 0xfc, 0xfc, 0x01, 0xf8, 0xfc, 0x01, 0xf0, 0x7c, 0x03, 0xf0, 0x7e, 0x03, 0xe0,
+    0x3e, 0x07, 0xe0, 0x3f, 0x07, 0xc0, 0x1f, 0x07, 0xc0, 0x1f, 0x8f, 0x80, 0x0f, 0x8f, 0x80, 0x0f,
+    0xdf, 0x00, 0x07, 0xdf, 0x00, 0x07, 0xfe, 0x00, 0x03, 0xfe, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc,
+    0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00,
+    0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00,
+    0xf8, 0x00, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xe0, 0x00, 0x07,
+    0xe0, 0x00, 0x0f, 0xc0, 0x00, 0x1f, 0x80, 0x00, 0x1f, 0x80, 0x00, 0x3f, 0x00, 0x00, 0x7e, 0x00,
+    0x00, 0xfe, 0x00, 0x00, 0xfc, 0x00, 0x01, 0xf8, 0x00, 0x03, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07,
+    0xe0, 0x00, 0x0f, 0xc0, 0x00, 0x1f, 0x80, 0x00, 0x1f, 0x80, 0x00, 0x3f, 0x00, 0x00, 0x7e, 0x00,
+    0x00, 0xfe, 0x00, 0x00, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xe0,
+    0xff, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8,
+    0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xff, 0xff, 0xff,
+    0xff, 0xe0, 0x00, 0xe0, 0x00, 0x60, 0x00, 0x60, 0x00, 0x70, 0x00, 0x30, 0x00, 0x30, 0x00, 0x38,
+    0x00, 0x18, 0x00, 0x18, 0x00, 0x1c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0e, 0x00, 0x06,
+    0x00, 0x06, 0x00, 0x07, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01,
+    0xc0, 0x01, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f,
+    0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f, 0x1f,
+    0xff, 0xff, 0xff, 0xff, 0x03, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0x78,
+    0x1e, 0x78, 0x1e, 0x78, 0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x1e, 0x78, 0x1e, 0x78, 0x1e, 0x70, 0x0f,
+    0xf0, 0x0f, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xf8, 0xf8, 0x78, 0x3c, 0x1c, 0x0e,
+    0x07, 0xf8, 0x00, 0x1f, 0xfe, 0x00, 0x3f, 0xff, 0x00, 0x7f, 0xff, 0x80, 0x7c, 0x1f, 0x80, 0xf8,
+    0x0f, 0x80, 0x00, 0x0f, 0x80, 0x00, 0x7f, 0x80, 0x0f, 0xff, 0x80, 0x3f, 0xff, 0x80, 0x7f, 0x8f,
+    0x80, 0xfc, 0x0f, 0x80, 0xf8, 0x0f, 0x80, 0xf8, 0x1f, 0x80, 0xfc, 0x3f, 0x80, 0xff, 0xff, 0x80,
+    0x7f, 0xff, 0x80, 0x3f, 0xef, 0xc0, 0x1f, 0x8f, 0xc0, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8,
+    0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf9, 0xf8,
+    0x00, 0xfb, 0xfc, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xfe, 0x1f, 0x80, 0xfc, 0x0f, 0x80,
+    0xfc, 0x0f, 0xc0, 0xf8, 0x07, 0xc0, 0xf8, 0x07, 0xc0, 0xf8, 0x07, 0xc0, 0xf8, 0x07, 0xc0, 0xf8,
+    0x07, 0xc0, 0xfc, 0x0f, 0xc0, 0xfc, 0x0f, 0x80, 0xfe, 0x1f, 0x80, 0xff, 0xff, 0x00, 0xff, 0xff,
+    0x00, 0xfb, 0xfc, 0x00, 0xf9, 0xf8, 0x00, 0x03, 0xf0, 0x00, 0x0f, 0xfc, 0x00, 0x3f, 0xfe, 0x00,
+    0x3f, 0xff, 0x00, 0x7e, 0x1f, 0x80, 0x7c, 0x0f, 0x80, 0xf8, 0x0f, 0x80, 0xf8, 0x00, 0x00, 0xf8,
+    0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x0f, 0x80, 0x7c, 0x0f,
+    0x80, 0x7e, 0x1f, 0x80, 0x3f, 0xff, 0x00, 0x3f, 0xfe, 0x00, 0x1f, 0xfc, 0x00, 0x03, 0xf0, 0x00,
+    0x00, 0x03, 0xe0, 0x00, 0x03, 0xe0, 0x00, 0x03, 0xe0, 0x00, 0x03, 0xe0, 0x00, 0x03, 0xe0, 0x00,
+    0x03, 0xe0, 0x00, 0x03, 0xe0, 0x03, 0xe3, 0xe0, 0x0f, 0xfb, 0xe0, 0x1f, 0xff, 0xe0, 0x3f, 0xff,
+    0xe0, 0x7f, 0x1f, 0xe0, 0x7c, 0x07, 0xe0, 0xfc, 0x07, 0xe0, 0xf8, 0x03, 0xe0, 0xf8, 0x03, 0xe0,
+    0xf8, 0x03, 0xe0, 0xf8, 0x03, 0xe0, 0xf8, 0x03, 0xe0, 0xfc, 0x07, 0xe0, 0x7c, 0x07, 0xe0, 0x7e,
+    0x1f, 0xe0, 0x3f, 0xff, 0xe0, 0x1f, 0xff, 0xe0, 0x0f, 0xfb, 0xe0, 0x07, 0xe3, 0xe0, 0x07, 0xe0,
+    0x00, 0x1f, 0xf8, 0x00, 0x3f, 0xfe, 0x00, 0x3f, 0xfe, 0x00, 0x7e, 0x1f, 0x00, 0x7c, 0x0f, 0x00,
+    0xf8, 0x0f, 0x80, 0xf8, 0x07, 0x80, 0xff, 0xff, 0x80, 0xff, 0xff, 0x80, 0xff, 0xff, 0x80, 0xf8,
+    0x00, 0x00, 0xf8, 0x00, 0x00, 0xfc, 0x0f, 0x80, 0x7e, 0x1f, 0x80, 0x7f, 0xff, 0x00, 0x3f, 0xfe,
+    0x00, 0x1f, 0xfc, 0x00, 0x07, 0xf0, 0x00, 0x0f, 0xc0, 0x1f, 0xc0, 0x3f, 0xc0, 0x3f, 0xc0, 0x3e,
+    0x00, 0x3e, 0x00, 0x3e, 0x00, 0xff, 0x80, 0xff, 0x80, 0xff, 0x80, 0x3e, 0x00, 0x3e, 0x00, 0x3e,
+    0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e,
+    0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x07, 0xc7, 0xc0, 0x0f, 0xf7,
+    0xc0, 0x3f, 0xff, 0xc0, 0x3f, 0xff, 0xc0, 0x7e, 0x1f, 0xc0, 0x7c, 0x0f, 0xc0, 0xfc, 0x0f, 0xc0,
+    0xf8, 0x07, 0xc0, 0xf8, 0x07, 0xc0, 0xf8, 0x07, 0xc0, 0xf8, 0x07, 0xc0, 0xf8, 0x07, 0xc0, 0xfc,
+    0x0f, 0xc0, 0x7c, 0x0f, 0xc0, 0x7e, 0x1f, 0xc0, 0x7f, 0xff, 0xc0, 0x3f, 0xff, 0xc0, 0x1f, 0xf7,
+    0xc0, 0x07, 0xc7, 0xc0, 0x00, 0x07, 0xc0, 0x00, 0x07, 0xc0, 0xfc, 0x0f, 0xc0, 0x7e, 0x1f, 0x80,
+    0x7f, 0xff, 0x00, 0x3f, 0xfe, 0x00, 0x07, 0xf8, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8,
+    0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0xf8,
+    0x00, 0xfb, 0xfe, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xfe, 0x1f, 0x80, 0xfc, 0x0f, 0x80,
+    0xf8, 0x0f, 0x80, 0xf8, 0x0f, 0x80, 0xf8, 0x0f, 0x80, 0xf8, 0x0f, 0x80, 0xf8, 0x0f, 0x80, 0xf8,
+    0x0f, 0x80, 0xf8, 0x0f, 0x80, 0xf8, 0x0f, 0x80, 0xf8, 0x0f, 0x80, 0xf8, 0x0f, 0x80, 0xf8, 0x0f,
+    0x80, 0xf8, 0x0f, 0x80, 0xf8, 0x0f, 0x80, 0xf8, 0xf8, 0xf8, 0xf8, 0x00, 0x00, 0x00, 0xf8, 0xf8,
+    0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8,
+    0xf8, 0x3e, 0x3e, 0x3e, 0x3e, 0x00, 0x00, 0x00, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e,
+    0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0xfe, 0xfe,
+    0xfc, 0xf8, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00,
+    0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x1f, 0x00, 0xf8, 0x3e, 0x00, 0xf8, 0x7e, 0x00,
+    0xf8, 0xfc, 0x00, 0xf9, 0xf8, 0x00, 0xf9, 0xf0, 0x00, 0xfb, 0xe0, 0x00, 0xff, 0xe0, 0x00, 0xff,
+    0xe0, 0x00, 0xff, 0xf0, 0x00, 0xff, 0xf0, 0x00, 0xfd, 0xf8, 0x00, 0xf8, 0xf8, 0x00, 0xf8, 0x7c,
+    0x00, 0xf8, 0x7e, 0x00, 0xf8, 0x3e, 0x00, 0xf8, 0x3f, 0x00, 0xf8, 0x1f, 0x00, 0xf8, 0x1f, 0x80,
+    0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8,
+    0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0x3f, 0x00, 0xfb, 0xfc,
+    0xff, 0x80, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xe0, 0xfc, 0x3f, 0x87, 0xe0, 0xfc, 0x1f,
+    0x83, 0xe0, 0xf8, 0x1f, 0x03, 0xe0, 0xf8, 0x1f, 0x03, 0xe0, 0xf8, 0x1f, 0x03, 0xe0, 0xf8, 0x1f,
+    0x03, 0xe0, 0xf8, 0x1f, 0x03, 0xe0, 0xf8, 0x1f, 0x03, 0xe0, 0xf8, 0x1f, 0x03, 0xe0, 0xf8, 0x1f,
+    0x03, 0xe0, 0xf8, 0x1f, 0x03, 0xe0, 0xf8, 0x1f, 0x03, 0xe0, 0xf8, 0x1f, 0x03, 0xe0, 0xf8, 0x1f,
+    0x03, 0xe0, 0xf8, 0x1f, 0x03, 0xe0, 0xf8, 0xf8, 0x00, 0xfb, 0xfe, 0x00, 0xff, 0xff, 0x00, 0xff,
+    0xff, 0x00, 0xfe, 0x1f, 0x80, 0xfc, 0x0f, 0x80, 0xf8, 0x0f, 0x80, 0xf8, 0x0f, 0x80, 0xf8, 0x0f,
+    0x80, 0xf8, 0x0f, 0x80, 0xf8, 0x0f, 0x80, 0xf8, 0x0f, 0x80, 0xf8, 0x0f, 0x80, 0xf8, 0x0f, 0x80,
+    0xf8, 0x0f, 0x80, 0xf8, 0x0f, 0x80, 0xf8, 0x0f, 0x80, 0xf8, 0x0f, 0x80, 0xf8, 0x0f, 0x80, 0x03,
+    0xf8, 0x00, 0x0f, 0xfe, 0x00, 0x1f, 0xff, 0x00, 0x3f, 0xff, 0x80, 0x7f, 0x0f, 0xc0, 0x7c, 0x07,
+    0xc0, 0xfc, 0x07, 0xe0, 0xf8, 0x03, 0xe0, 0xf8, 0x03, 0xe0, 0xf8, 0x03, 0xe0, 0xf8, 0x03, 0xe0,
+    0xf8, 0x03, 0xe0, 0xfc, 0x07, 0xe0, 0x7c, 0x07, 0xc0, 0x7e, 0x1f, 0xc0, 0x3f, 0xff, 0x80, 0x1f,
+    0xff, 0x00, 0x0f, 0xfe, 0x00, 0x03, 0xf8, 0x00, 0xf8, 0xf8, 0x00, 0xfb, 0xfe, 0x00, 0xff, 0xff,
+    0x00, 0xff, 0xff, 0x00, 0xfe, 0x1f, 0x80, 0xfc, 0x0f, 0x80, 0xfc, 0x0f, 0xc0, 0xf8, 0x07, 0xc0,
+    0xf8, 0x07, 0xc0, 0xf8, 0x07, 0xc0, 0xf8, 0x07, 0xc0, 0xf8, 0x07, 0xc0, 0xfc, 0x0f, 0xc0, 0xfc,
+    0x0f, 0x80, 0xfe, 0x1f, 0x80, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xfb, 0xfc, 0x00, 0xf8, 0xf8,
+    0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00,
+    0xf8, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x07, 0xe3, 0xe0, 0x0f, 0xfb, 0xe0, 0x1f, 0xff, 0xe0, 0x3f,
+    0xff, 0xe0, 0x7f, 0x1f, 0xe0, 0x7c, 0x07, 0xe0, 0xfc, 0x07, 0xe0, 0xf8, 0x03, 0xe0, 0xf8, 0x03,
+    0xe0, 0xf8, 0x03, 0xe0, 0xf8, 0x03, 0xe0, 0xf8, 0x03, 0xe0, 0xfc, 0x07, 0xe0, 0x7c, 0x07, 0xe0,
+    0x7e, 0x0f, 0xe0, 0x3f, 0xff, 0xe0, 0x3f, 0xff, 0xe0, 0x0f, 0xfb, 0xe0, 0x07, 0xe3, 0xe0, 0x00,
+    0x03, 0xe0, 0x00, 0x03, 0xe0, 0x00, 0x03, 0xe0, 0x00, 0x03, 0xe0, 0x00, 0x03, 0xe0, 0x00, 0x03,
+    0xe0, 0x00, 0x03, 0xe0, 0xf8, 0xe0, 0xfb, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xfe, 0x00, 0xfc, 0x00,
+    0xf8, 0x00, 0xf8, 0x00, 0xf8, 0x00, 0xf8, 0x00, 0xf8, 0x00, 0xf8, 0x00, 0xf8, 0x00, 0xf8, 0x00,
+    0xf8, 0x00, 0xf8, 0x00, 0xf8, 0x00, 0xf8, 0x00, 0xf8, 0x00, 0x07, 0xf0, 0x00, 0x1f, 0xfc, 0x00,
+    0x3f, 0xfe, 0x00, 0x3f, 0xff, 0x00, 0x7e, 0x1f, 0x00, 0x7c, 0x0f, 0x00, 0x7e, 0x00, 0x00, 0x7f,
+    0xc0, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xff, 0x00, 0x0f, 0xff, 0x00, 0x01, 0xff, 0x80, 0x00, 0x1f,
+    0x80, 0xf8, 0x0f, 0x80, 0x7c, 0x1f, 0x80, 0x7f, 0xff, 0x00, 0x3f, 0xff, 0x00, 0x1f, 0xfe, 0x00,
+    0x07, 0xf8, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0xff, 0x80, 0xff,
+    0x80, 0xff, 0x80, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e,
+    0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3e, 0x00, 0x3f, 0x80, 0x3f, 0x80, 0x1f, 0x80, 0x0f,
+    0x80, 0xf8, 0x0f, 0x80, 0xf8, 0x0f, 0x80, 0xf8, 0x0f, 0x80, 0xf8, 0x0f, 0x80, 0xf8, 0x0f, 0x80,
+    0xf8, 0x0f, 0x80, 0xf8, 0x0f, 0x80, 0xf8, 0x0f, 0x80, 0xf8, 0x0f, 0x80, 0xf8, 0x0f, 0x80, 0xf8,
+    0x0f, 0x80, 0xf8, 0x0f, 0x80, 0xf8, 0x0f, 0x80, 0xf8, 0x1f, 0x80, 0xfc, 0x3f, 0x80, 0xff, 0xff,
+    0x80, 0x7f, 0xff, 0x80, 0x3f, 0xef, 0x80, 0x1f, 0x8f, 0x80, 0x7c, 0x07, 0xc0, 0x7c, 0x07, 0xc0,
+    0x7c, 0x07, 0xc0, 0x3e, 0x0f, 0x80, 0x3e, 0x0f, 0x80, 0x3e, 0x0f, 0x80, 0x1e, 0x0f, 0x00, 0x1f,
+    0x1f, 0x00, 0x1f, 0x1f, 0x00, 0x0f, 0x1e, 0x00, 0x0f, 0x9e, 0x00, 0x0f, 0xbe, 0x00, 0x07, 0xbc,
+    0x00, 0x07, 0xfc, 0x00, 0x07, 0xfc, 0x00, 0x03, 0xf8, 0x00, 0x03, 0xf8, 0x00, 0x03, 0xf8, 0x00,
+    0x01, 0xf0, 0x00, 0xfc, 0x1f, 0x03, 0xe0, 0x7c, 0x1f, 0x03, 0xe0, 0x7c, 0x1f, 0x87, 0xc0, 0x7c,
+    0x1f, 0x87, 0xc0, 0x3c, 0x3f, 0x87, 0xc0, 0x3e, 0x3f, 0x87, 0x80, 0x3e, 0x3f, 0xcf, 0x80, 0x3e,
+    0x3b, 0xcf, 0x80, 0x1e, 0x7b, 0xcf, 0x80, 0x1f, 0x79, 0xcf, 0x00, 0x1f, 0x79, 0xcf, 0x00, 0x0f,
+    0x71, 0xff, 0x00, 0x0f, 0x71, 0xfe, 0x00, 0x0f, 0xf1, 0xfe, 0x00, 0x0f, 0xf0, 0xfe, 0x00, 0x07,
+    0xe0, 0xfe, 0x00, 0x07, 0xe0, 0xfc, 0x00, 0x07, 0xe0, 0xfc, 0x00, 0x03, 0xe0, 0xfc, 0x00, 0xfc,
+    0x1f, 0x80, 0x7c, 0x1f, 0x80, 0x7e, 0x3f, 0x00, 0x3e, 0x3e, 0x00, 0x1f, 0x7e, 0x00, 0x1f, 0x7c,
+    0x00, 0x0f, 0xf8, 0x00, 0x07, 0xf8, 0x00, 0x07, 0xf0, 0x00, 0x03, 0xe0, 0x00, 0x07, 0xf0, 0x00,
+    0x0f, 0xf8, 0x00, 0x0f, 0xf8, 0x00, 0x1f, 0x7c, 0x00, 0x3f, 0x7e, 0x00, 0x3e, 0x3e, 0x00, 0x7e,
+    0x3f, 0x00, 0x7c, 0x1f, 0x80, 0xfc, 0x0f, 0x80, 0x7c, 0x03, 0xe0, 0x7c, 0x07, 0xc0, 0x7e, 0x07,
+    0xc0, 0x3e, 0x07, 0xc0, 0x3e, 0x0f, 0x80, 0x3e, 0x0f, 0x80, 0x1f, 0x0f, 0x80, 0x1f, 0x0f, 0x00,
+    0x0f, 0x1f, 0x00, 0x0f, 0x9e, 0x00, 0x0f, 0x9e, 0x00, 0x07, 0xbe, 0x00, 0x07, 0xfc, 0x00, 0x07,
+    0xfc, 0x00, 0x03, 0xfc, 0x00, 0x03, 0xf8, 0x00, 0x01, 0xf8, 0x00, 0x01, 0xf8, 0x00, 0x01, 0xf0,
+    0x00, 0x01, 0xf0, 0x00, 0x01, 0xe0, 0x00, 0x03, 0xe0, 0x00, 0x1f, 0xe0, 0x00, 0x1f, 0xc0, 0x00,
+    0x1f, 0x80, 0x00, 0x1f, 0x00, 0x00, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x00, 0x7e,
+    0x00, 0xfc, 0x01, 0xf8, 0x03, 0xf0, 0x03, 0xf0, 0x07, 0xe0, 0x0f, 0xc0, 0x1f, 0x80, 0x3f, 0x00,
+    0x7e, 0x00, 0xfe, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0x80, 0x0f, 0x80,
+    0x1f, 0x80, 0x1f, 0x80, 0x1e, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x1e, 0x00,
+    0x1e, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x3e, 0x00, 0xfc, 0x00, 0xf0, 0x00, 0xfc, 0x00,
+    0x3e, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x1e, 0x00,
+    0x1e, 0x00, 0x1e, 0x00, 0x1e, 0x00, 0x1f, 0x80, 0x1f, 0x80, 0x0f, 0x80, 0x07, 0x80, 0xe0, 0xe0,
+    0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0,
+    0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xf0,
+    0x00, 0xf8, 0x00, 0xf8, 0x00, 0xfc, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c,
+    0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3e, 0x00, 0x1f,
+    0x80, 0x07, 0x80, 0x1f, 0x80, 0x3e, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c,
+    0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0x3c, 0x00, 0xfc, 0x00, 0xf8, 0x00, 0xf8, 0x00, 0xf0,
+    0x00, 0x3c, 0x00, 0x7f, 0x06, 0xff, 0x86, 0xc3, 0xfe, 0xc0, 0xfc, 0x00, 0x78,
+};
+
+inline constexpr FontGlyph FreeSansBold18pt7bGlyphs[] = {
+    {0, 0, 0, 10, 0, 1, 1},   // 0x20 ' '
+    {0, 5, 25, 12, 4, -24, 1},   // 0x21 '!'
+    {25, 13, 9, 17, 2, -25, 1},   // 0x22 '"'
+    {43, 20, 24, 19, 0, -23, 0},   // 0x23 '#'
+    {115, 19, 29, 19, 0, -25, 1},   // 0x24 '$'
+    {202, 29, 25, 31, 1, -24, 1},   // 0x25 '%'
+    {302, 22, 25, 25, 2, -24, 1},   // 0x26 '&'
+    {377, 5, 9, 9, 2, -25, 1},   // 0x27 '''
+    {386, 9, 33, 12, 1, -25, 1},   // 0x28 '('
+    {452, 9, 33, 12, 1, -25, 1},   // 0x29 ')'
+    {518, 12, 11, 14, 0, -25, 1},   // 0x2A '*'
+    {540, 16, 16, 20, 2, -15, 1},   // 0x2B '+'
+    {572, 5, 11, 9, 2, -4, 1},   // 0x2C ','
+    {583, 9, 4, 12, 1, -10, 1},   // 0x2D '-'
+    {591, 5, 5, 9, 2, -4, 1},   // 0x2E '.'
+    {596, 9, 25, 10, 0, -24, 1},   // 0x2F '/'
+    {646, 17, 25, 19, 1, -24, 1},   // 0x30 '0'
+    {721, 10, 25, 19, 3, -24, 1},   // 0x31 '1'
+    {771, 17, 25, 19, 1, -24, 1},   // 0x32 '2'
+    {846, 17, 25, 19, 1, -24, 1},   // 0x33 '3'
+    {921, 16, 25, 19, 2, -24, 1},   // 0x34 '4'
+    {971, 17, 25, 19, 1, -24, 1},   // 0x35 '5'
+    {1046, 18, 25, 19, 1, -24, 1},   // 0x36 '6'
+    {1121, 17, 25, 19, 1, -24, 1},   // 0x37 '7'
+    {1196, 17, 25, 19, 1, -24, 1},   // 0x38 '8'
+    {1271, 17, 25, 19, 1, -24, 1},   // 0x39 '9'
+    {1346, 5, 18, 9, 2, -17, 1},   // 0x3A ':'
+    {1364, 5, 24, 9, 2, -17, 1},   // 0x3B ';'
+    {1388, 18, 17, 20, 1, -16, 1},   // 0x3C '<'
+    {1439, 17, 12, 20, 2, -13, 1},   // 0x3D '='
+    {1475, 18, 17, 20, 1, -16, 1},   // 0x3E '>'
+    {1526, 18, 26, 21, 2, -25, 1},   // 0x3F '?'
+    {1604, 32, 31, 34, 1, -25, 1},   // 0x40 '@'
+    {1728, 24, 26, 24, 0, -25, 1},   // 0x41 'A'
+    {1806, 20, 26, 25, 3, -25, 1},   // 0x42 'B'
+    {1884, 23, 26, 25, 1, -25, 1},   // 0x43 'C'
+    {1962, 21, 26, 25, 3, -25, 1},   // 0x44 'D'
+    {2040, 19, 26, 23, 3, -25, 1},   // 0x45 'E'
+    {2118, 17, 26, 22, 3, -25, 1},   // 0x46 'F'
+    {2196, 24, 26, 27, 1, -25, 1},   // 0x47 'G'
+    {2274, 20, 26, 26, 3, -25, 1},   // 0x48 'H'
+    {2352, 5, 26, 11, 3, -25, 1},   // 0x49 'I'
+    {2378, 16, 26, 20, 1, -25, 1},   // 0x4A 'J'
+    {2430, 22, 26, 25, 3, -25, 1},   // 0x4B 'K'
+    {2508, 17, 26, 22, 3, -25, 1},   // 0x4C 'L'
+    {2586, 24, 26, 30, 3, -25, 1},   // 0x4D 'M'
+    {2664, 20, 26, 26, 3, -25, 1},   // 0x4E 'N'
+    {2742, 25, 26, 27, 1, -25, 1},   // 0x4F 'O'
+    {2846, 19, 26, 24, 3, -25, 1},   // 0x50 'P'
+    {2924, 25, 27, 27, 1, -25, 1},   // 0x51 'Q'
+    {3032, 21, 26, 25, 3, -25, 1},   // 0x52 'R'
+    {3110, 20, 26, 24, 2, -25, 1},   // 0x53 'S'
+    {3188, 19, 26, 23, 2, -25, 1},   // 0x54 'T'
+    {3266, 20, 26, 26, 3, -25, 1},   // 0x55 'U'
+    {3344, 22, 26, 23, 1, -25, 1},   // 0x56 'V'
+    {3422, 32, 26, 34, 1, -25, 1},   // 0x57 'W'
+    {3526, 22, 26, 24, 1, -25, 1},   // 0x58 'X'
+    {3604, 21, 26, 22, 1, -25, 1},   // 0x59 'Y'
+    {3682, 19, 26, 21, 1, -25, 1},   // 0x5A 'Z'
+    {3760, 8, 33, 12, 2, -25, 1},   // 0x5B '['
+    {3793, 10, 25, 10, 0, -24, 1},   // 0x5C '\\'
+    {3843, 8, 33, 12, 1, -25, 1},   // 0x5D ']'
+    {3876, 16, 15, 20, 2, -23, 1},   // 0x5E '^'
+    {3906, 21, 3, 19, -1, 5, 0},   // 0x5F '_'
+    {3915, 7, 5, 9, 1, -25, 1},   // 0x60 '`'
+    {3920, 18, 19, 20, 1, -18, 1},   // 0x61 'a'
+    {3977, 18, 26, 22, 2, -25, 1},   // 0x62 'b'
+    {4055, 17, 19, 20, 1, -18, 1},   // 0x63 'c'
+    {4112, 19, 26, 22, 1, -25, 1},   // 0x64 'd'
+    {4190, 18, 19, 20, 1, -18, 1},   // 0x65 'e'
+    {4247, 10, 26, 12, 1, -25, 1},   // 0x66 'f'
+    {4299, 18, 26, 21, 1, -18, 1},   // 0x67 'g'
+    {4377, 17, 26, 21, 2, -25, 1},   // 0x68 'h'
+    {4455, 5, 26, 10, 2, -25, 1},   // 0x69 'i'
+    {4481, 7, 33, 10, 0, -25, 1},   // 0x6A 'j'
+    {4514, 17, 26, 20, 2, -25, 1},   // 0x6B 'k'
+    {4592, 5, 26, 9, 2, -25, 1},   // 0x6C 'l'
+    {4618, 27, 19, 31, 2, -18, 1},   // 0x6D 'm'
+    {4694, 17, 19, 21, 2, -18, 1},   // 0x6E 'n'
+    {4751, 19, 19, 21, 1, -18, 1},   // 0x6F 'o'
+    {4808, 18, 26, 22, 2, -18, 1},   // 0x70 'p'
+    {4886, 19, 26, 22, 1, -18, 1},   // 0x71 'q'
+    {4964, 11, 19, 14, 2, -18, 1},   // 0x72 'r'
+    {5002, 17, 19, 19, 1, -18, 1},   // 0x73 's'
+    {5059, 9, 23, 12, 1, -22, 1},   // 0x74 't'
+    {5105, 17, 19, 21, 2, -18, 1},   // 0x75 'u'
+    {5162, 19, 19, 19, 0, -18, 1},   // 0x76 'v'
+    {5219, 27, 19, 27, 0, -18, 1},   // 0x77 'w'
+    {5295, 18, 19, 19, 1, -18, 1},   // 0x78 'x'
+    {5352, 19, 26, 19, 0, -18, 1},   // 0x79 'y'
+    {5430, 16, 19, 18, 1, -18, 1},   // 0x7A 'z'
+    {5468, 9, 33, 14, 1, -25, 1},   // 0x7B '{'
+    {5534, 3, 33, 10, 4, -25, 1},   // 0x7C '|'
+    {5567, 9, 33, 14, 3, -25, 1},   // 0x7D '}'
+    {5633, 15, 6, 18, 1, -10, 1},   // 0x7E '~'
+};
+
+inline constexpr Font FreeSansBold18pt7b = {
+    FreeSansBold18pt7bBitmaps, FreeSansBold18pt7bGlyphs, 0x20, 0x7E, 42, 25, 8};
+
+// FreeSansBold24pt7b.h: 14 glyphs from 0x20 to 0x3A, 1045 bitmap bytes
+inline constexpr uint8_t FreeSansBold24pt7bBitmaps[] = {
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0x0e, 0x0e, 0x0e, 0x1e, 0x1c, 0xfc, 0xf8, 0xe0, 0xff,
+    0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0xff, 0xf8, 0x00, 0xff, 0x00, 0x03, 0xff,
+    0xc0, 0x0f, 0xff, 0xf0, 0x1f, 0xff, 0xf8, 0x1f, 0xff, 0xf8, 0x3f, 0xff, 0xfc, 0x3f, 0xc3, 0xfc,
+    0x7f, 0x81, 0xfe, 0x7f, 0x00, 0xfe, 0x7f, 0x00, 0xfe, 0x7f, 0x00, 0xfe, 0xfe, 0x00, 0x7f, 0xfe,
+    0x00, 0x7f, 0xfe, 0x00, 0x7f, 0xfe, 0x00, 0x7f, 0xfe, 0x00, 0x7f, 0xfe, 0x00, 0x7f, 0xfe, 0x00,
+    0x7f, 0xfe, 0x00, 0x7f, 0xfe, 0x00, 0x7f, 0xfe, 0x00, 0x7f, 0xfe, 0x00, 0x7f, 0xfe, 0x00, 0x7f,
+    0xfe, 0x00, 0x7f, 0x7f, 0x00, 0xfe, 0x7f, 0x00, 0xfe, 0x7f, 0x00, 0xfe, 0x7f, 0x81, 0xfe, 0x3f,
+    0xc3, 0xfc, 0x3f, 0xff, 0xfc, 0x1f, 0xff, 0xf8, 0x1f, 0xff, 0xf8, 0x0f, 0xff, 0xf0, 0x03, 0xff,
+    0xc0, 0x00, 0xff, 0x00, 0x00, 0x3c, 0x00, 0x7c, 0x00, 0x7c, 0x00, 0xfc, 0x01, 0xfc, 0x0f, 0xfc,
+    0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0x01, 0xfc, 0x01, 0xfc, 0x01, 0xfc, 0x01, 0xfc,
+    0x01, 0xfc, 0x01, 0xfc, 0x01, 0xfc, 0x01, 0xfc, 0x01, 0xfc, 0x01, 0xfc, 0x01, 0xfc, 0x01, 0xfc,
+    0x01, 0xfc, 0x01, 0xfc, 0x01, 0xfc, 0x01, 0xfc, 0x01, 0xfc, 0x01, 0xfc, 0x01, 0xfc, 0x01, 0xfc,
+    0x01, 0xfc, 0x01, 0xfc, 0x01, 0xfc, 0x01, 0xfe, 0x00, 0x07, 0xff, 0xc0, 0x0f, 0xff, 0xe0, 0x1f,
+    0xff, 0xf0, 0x3f, 0xff, 0xf8, 0x7f, 0xff, 0xfc, 0x7f, 0x83, 0xfc, 0xff, 0x01, 0xfe, 0xfe, 0x01,
+    0xfe, 0xfe, 0x00, 0xfe, 0xfe, 0x00, 0xfe, 0xfe, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe,
+    0x00, 0x01, 0xfe, 0x00, 0x01, 0xfc, 0x00, 0x03, 0xfc, 0x00, 0x07, 0xf8, 0x00, 0x1f, 0xf0, 0x00,
+    0x3f, 0xe0, 0x00, 0x7f, 0x80, 0x01, 0xff, 0x00, 0x03, 0xfc, 0x00, 0x07, 0xf8, 0x00, 0x0f, 0xf0,
+    0x00, 0x1f, 0xe0, 0x00, 0x1f, 0xc0, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0xff, 0xfe, 0x3f, 0xff, 0xfe,
+    0x7f, 0xff, 0xfe, 0x7f, 0xff, 0xfe, 0x7f, 0xff, 0xfe, 0x7f, 0xff, 0xfe, 0x01, 0xfe, 0x00, 0x07,
+    0xff, 0xc0, 0x1f, 0xff, 0xe0, 0x3f, 0xff, 0xf0, 0x7f, 0xff, 0xf8, 0x7f, 0xff, 0xf8, 0x7f, 0x87,
+    0xfc, 0xff, 0x03, 0xfc, 0xfe, 0x01, 0xfc, 0xfe, 0x01, 0xfc, 0xfe, 0x01, 0xfc, 0x00, 0x01, 0xfc,
+    0x00, 0x01, 0xf8, 0x00, 0x03, 0xf8, 0x00, 0x07, 0xf0, 0x00, 0x3f, 0xe0, 0x00, 0x3f, 0xc0, 0x00,
+    0x3f, 0xe0, 0x00, 0x3f, 0xf8, 0x00, 0x07, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfe, 0x00, 0x00,
+    0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0xfe, 0x00, 0xfe, 0xfe, 0x01, 0xfe, 0xff, 0x01, 0xfe,
+    0x7f, 0x83, 0xfc, 0x7f, 0xff, 0xfc, 0x7f, 0xff, 0xf8, 0x3f, 0xff, 0xf0, 0x1f, 0xff, 0xe0, 0x07,
+    0xff, 0xc0, 0x01, 0xfe, 0x00, 0x00, 0x1f, 0xe0, 0x00, 0x1f, 0xe0, 0x00, 0x3f, 0xe0, 0x00, 0x3f,
+    0xe0, 0x00, 0x7f, 0xe0, 0x00, 0xff, 0xe0, 0x00, 0xff, 0xe0, 0x01, 0xef, 0xe0, 0x01, 0xef, 0xe0,
+    0x03, 0xcf, 0xe0, 0x07, 0x8f, 0xe0, 0x07, 0x8f, 0xe0, 0x0f, 0x0f, 0xe0, 0x0e, 0x0f, 0xe0, 0x1e,
+    0x0f, 0xe0, 0x1c, 0x0f, 0xe0, 0x3c, 0x0f, 0xe0, 0x78, 0x0f, 0xe0, 0x70, 0x0f, 0xe0, 0xf0, 0x0f,
+    0xe0, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xfc,
+    0xff, 0xff, 0xfc, 0x00, 0x0f, 0xe0, 0x00, 0x0f, 0xe0, 0x00, 0x0f, 0xe0, 0x00, 0x0f, 0xe0, 0x00,
+    0x0f, 0xe0, 0x00, 0x0f, 0xe0, 0x00, 0x0f, 0xe0, 0x1f, 0xff, 0xfc, 0x1f, 0xff, 0xfc, 0x1f, 0xff,
+    0xfc, 0x1f, 0xff, 0xfc, 0x3f, 0xff, 0xfc, 0x3f, 0xff, 0xfc, 0x3e, 0x00, 0x00, 0x3e, 0x00, 0x00,
+    0x3e, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x7c, 0x7e, 0x00, 0x7d, 0xff, 0xc0, 0x7f, 0xff, 0xe0, 0x7f,
+    0xff, 0xf0, 0x7f, 0xff, 0xf8, 0xff, 0xff, 0xf8, 0xfe, 0x07, 0xfc, 0x00, 0x03, 0xfc, 0x00, 0x01,
+    0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe, 0x00, 0x00, 0xfe,
+    0x00, 0x00, 0xfe, 0xfc, 0x01, 0xfe, 0xfe, 0x03, 0xfc, 0xff, 0x07, 0xfc, 0xff, 0xff, 0xf8, 0x7f,
+    0xff, 0xf8, 0x3f, 0xff, 0xf0, 0x1f, 0xff, 0xc0, 0x0f, 0xff, 0x80, 0x01, 0xfc, 0x00, 0x00, 0xff,
+    0x00, 0x03, 0xff, 0xc0, 0x07, 0xff, 0xf0, 0x0f, 0xff, 0xf0, 0x1f, 0xff, 0xf8, 0x3f, 0xff, 0xfc,
+    0x3f, 0xc3, 0xfc, 0x7f, 0x81, 0xfc, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0xfe,
+    0x00, 0x00, 0xfe, 0x3f, 0x00, 0xfe, 0xff, 0xc0, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xf8, 0xff, 0xff,
+    0xf8, 0xff, 0xc3, 0xfc, 0xff, 0x01, 0xfc, 0xff, 0x01, 0xfe, 0xfe, 0x00, 0xfe, 0xfe, 0x00, 0xfe,
+    0xfe, 0x00, 0xfe, 0xfe, 0x00, 0xfe, 0x7e, 0x00, 0xfe, 0x7e, 0x00, 0xfe, 0x7f, 0x01, 0xfe, 0x7f,
+    0x01, 0xfc, 0x3f, 0xc7, 0xfc, 0x3f, 0xff, 0xf8, 0x1f, 0xff, 0xf8, 0x1f, 0xff, 0xf0, 0x0f, 0xff,
+    0xe0, 0x03, 0xff, 0xc0, 0x00, 0xfe, 0x00, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe,
+    0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0x00, 0x00, 0xfc, 0x00, 0x01, 0xf8, 0x00,
+    0x03, 0xf8, 0x00, 0x03, 0xf0, 0x00, 0x07, 0xe0, 0x00, 0x0f, 0xe0, 0x00, 0x0f, 0xc0, 0x00, 0x1f,
+    0xc0, 0x00, 0x1f, 0x80, 0x00, 0x3f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x7e, 0x00,
+    0x00, 0xfe, 0x00, 0x00, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x01, 0xf8, 0x00, 0x01,
+    0xf8, 0x00, 0x03, 0xf8, 0x00, 0x03, 0xf8, 0x00, 0x03, 0xf8, 0x00, 0x03, 0xf0, 0x00, 0x07, 0xf0,
+    0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x07, 0xf0, 0x00, 0x00, 0xfe, 0x00, 0x03, 0xff, 0xc0,
+    0x0f, 0xff, 0xe0, 0x1f, 0xff, 0xf0, 0x3f, 0xff, 0xf8, 0x3f, 0xff, 0xf8, 0x7f, 0x83, 0xfc, 0x7f,
+    0x00, 0xfc, 0x7e, 0x00, 0xfc, 0x7e, 0x00, 0x7c, 0x7e, 0x00, 0x7c, 0x7e, 0x00, 0xfc, 0x3f, 0x00,
+    0xf8, 0x3f, 0x83, 0xf8, 0x0f, 0xff, 0xf0, 0x07, 0xff, 0xc0, 0x0f, 0xff, 0xf0, 0x1f, 0xff, 0xf8,
+    0x3f, 0xc3, 0xfc, 0x7f, 0x00, 0xfe, 0x7f, 0x00, 0xfe, 0xfe, 0x00, 0x7f, 0xfe, 0x00, 0x7f, 0xfe,
+    0x00, 0x7f, 0xfe, 0x00, 0x7f, 0xfe, 0x00, 0x7f, 0xff, 0x00, 0xff, 0xff, 0x00, 0xfe, 0x7f, 0x83,
+    0xfe, 0x7f, 0xff, 0xfe, 0x3f, 0xff, 0xfc, 0x1f, 0xff, 0xf8, 0x0f, 0xff, 0xf0, 0x07, 0xff, 0xc0,
+    0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x03, 0xff, 0xc0, 0x0f, 0xff, 0xe0, 0x1f, 0xff, 0xf0, 0x3f,
+    0xff, 0xf8, 0x3f, 0xff, 0xfc, 0x7f, 0xc3, 0xfc, 0x7f, 0x01, 0xfe, 0xff, 0x00, 0xfe, 0xfe, 0x00,
+    0x7e, 0xfe, 0x00, 0x7e, 0xfe, 0x00, 0x7f, 0xfe, 0x00, 0x7f, 0xfe, 0x00, 0x7f, 0xfe, 0x00, 0x7f,
+    0xff, 0x00, 0xff, 0x7f, 0x01, 0xff, 0x7f, 0xc3, 0xff, 0x7f, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x1f,
+    0xff, 0xff, 0x0f, 0xff, 0x7f, 0x07, 0xfe, 0x7f, 0x01, 0xfc, 0x7e, 0x00, 0x00, 0x7e, 0x00, 0x00,
+    0xfe, 0x00, 0x00, 0xfe, 0x7f, 0x01, 0xfc, 0x7f, 0x83, 0xfc, 0x7f, 0xff, 0xf8, 0x3f, 0xff, 0xf8,
+    0x3f, 0xff, 0xf0, 0x1f, 0xff, 0xe0, 0x07, 0xff, 0x80, 0x01, 0xfe, 0x00, 0xfe, 0xfe, 0xfe, 0xfe,
+    0xfe, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe,
+    0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
+};
+
+inline constexpr FontGlyph FreeSansBold24pt7bGlyphs[] = {
+    {0, 0, 0, 13, 0, 1, 1},   // 0x20 ' '
+    {0, 0, 0, 0, 0, 0, 1},   // 0x21 '!'
+    {0, 0, 0, 0, 0, 0, 1},   // 0x22 '"'
+    {0, 0, 0, 0, 0, 0, 1},   // 0x23 '#'
+    {0, 0, 0, 0, 0, 0, 1},   // 0x24 '$'
+    {0, 0, 0, 0, 0, 0, 1},   // 0x25 '%'
+    {0, 0, 0, 0, 0, 0, 1},   // 0x26 '&'
+    {0, 0, 0, 0, 0, 0, 1},   // 0x27 '''
+    {0, 0, 0, 0, 0, 0, 1},   // 0x28 '('
+    {0, 0, 0, 0, 0, 0, 1},   // 0x29 ')'
+    {0, 0, 0, 0, 0, 0, 1},   // 0x2A '*'
+    {0, 0, 0, 0, 0, 0, 1},   // 0x2B '+'
+    {0, 7, 15, 12, 2, -6, 1},   // 0x2C ','
+    {15, 13, 6, 16, 1, -15, 1},   // 0x2D '-'
+    {0, 0, 0, 0, 0, 0, 1},   // 0x2E '.'
+    {0, 0, 0, 0, 0, 0, 1},   // 0x2F '/'
+    {27, 24, 35, 26, 1, -33, 1},   // 0x30 '0'
+    {132, 14, 33, 26, 4, -32, 1},   // 0x31 '1'
+    {198, 23, 34, 26, 2, -33, 1},   // 0x32 '2'
+    {300, 23, 35, 26, 2, -33, 1},   // 0x33 '3'
+    {405, 22, 33, 26, 2, -32, 1},   // 0x34 '4'
+    {504, 23, 34, 26, 2, -32, 1},   // 0x35 '5'
+    {606, 23, 35, 26, 2, -33, 1},   // 0x36 '6'
+    {711, 23, 33, 26, 1, -32, 1},   // 0x37 '7'
+    {810, 24, 35, 26, 1, -33, 1},   // 0x38 '8'
+    {915, 24, 35, 26, 1, -33, 1},   // 0x39 '9'
+    {1020, 7, 25, 12, 2, -24, 1},   // 0x3A ':'
+};
+
+inline constexpr Font FreeSansBold24pt7b = {
+    FreeSansBold24pt7bBitmaps, FreeSansBold24pt7bGlyphs, 0x20, 0x3A, 56, 33, 9};
+
+#endif /* __FONT_BITMAPS_H__ */
@@ -0,0 +1,93 @@
+/**
+  ******************************************************************************
+  * @file   frame_arena.cpp
+  * @author Pablo San Millán Fierro (pablo.sanmillanf@alumnos.upm.es)
+  * @brief  Per-frame bump allocator Module.
+  *
+  * @note   End-of-degree work.
+  *         This module provides the memory for the temporary buffers used
+  *         while a frame is drawn (rendered strings, icons being modified...).
+  *         Allocating only moves a pointer forward and all the buffers are
+  *         released at once when the frame ends, so drawing doesn't use the
+  *         heap or large stack arrays.
+  ******************************************************************************
+*/
+
+/* Includes ------------------------------------------------------------------*/
+#include "frame_arena.h" // Module header
+
+/* Private defines -----------------------------------------------------------*/
+/* Private typedef -----------------------------------------------------------*/
+/* Private variables----------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+/* Functions -----------------------------------------------------------------*/
+
+/**
+ * @brief Class constructor. Allocates the buffer of the arena.
+ *
+ * @param[in] capacity Initial size of the buffer in bytes. If a frame needs more, the extra buffers are
+ *                     taken from the heap and the buffer grows to fit them when the arena is reset.
+ */
+FrameArena::FrameArena(size_t capacity):
+    buffer(new uint8_t[capacity]), capacity(capacity), used(0), overflow_bytes(0){
+}
+
+
+/**
+ * @brief Releases all the buffers allocated since the previous reset. Must be called when the frame ends.
+ */
+void FrameArena::reset(){
+  if(!overflow.empty()){
+    //Grow the buffer so the same frame fits next time. Nothing allocated in the arena is alive now.
+    capacity = used + overflow_bytes;
+    buffer.reset(new uint8_t[capacity]);
+    overflow.clear();
+    overflow_bytes = 0;
+  }
+  used = 0;
+}
+
+
+/**
+ * @brief Obtain the number of bytes allocated since the previous reset.
+ *
+ * @return The number of bytes.
+ */
+size_t FrameArena::size_bytes() const{
+  return used + overflow_bytes;
+}
+
+
+/**
+ * @brief Obtain the size of the buffer of the arena.
+ *
+ * @return The number of bytes.
+ */
+size_t FrameArena::capacity_bytes() const{
+  return capacity;
+}
+
+
+/* Private functions ---------------------------------------------------------*/
+/**
+ * @brief Allocates an uninitialized block of memory. When it doesn't fit in the buffer, it is taken from
+ *        the heap and freed in the next reset.
+ *
+ * @param[in] bytes The size of the block.
+ * @param[in] alignment The alignment of the block. Must be a power of 2.
+ *
+ * @return The block.
+ */
+void *FrameArena::allocate(size_t bytes, size_t alignment){
+  size_t start = (used + alignment - 1) & ~(alignment - 1);
+
+  if(start + bytes <= capacity){
+    used = start + bytes;
+    return buffer.get() + start;
+  }
+
+  //new[] returns memory aligned for any fundamental type
+  overflow.emplace_back(new uint8_t[bytes ? bytes : 1]);
+  overflow_bytes += bytes + alignment;
+  return overflow.back().get();
+}
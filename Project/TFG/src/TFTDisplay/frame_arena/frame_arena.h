@@ -0,0 +1,100 @@
+/**
+  ******************************************************************************
+  * @file   frame_arena.h
+  * @author Pablo San Millán Fierro (pablo.sanmillanf@alumnos.upm.es)
+  * @brief  Per-frame bump allocator Module Header.
+  *
+  * @note   End-of-degree work.
+  *         This module provides the memory for the temporary buffers used
+  *         while a frame is drawn (rendered strings, icons being modified...).
+  *         Allocating only moves a pointer forward and all the buffers are
+  *         released at once when the frame ends, so drawing doesn't use the
+  *         heap or large stack arrays.
+  ******************************************************************************
+*/
+
+#ifndef __FRAME_ARENA_H__
+#define __FRAME_ARENA_H__
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stddef.h>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+ * Buffer of "count" elements allocated in a FrameArena. It is valid until the arena is reset.
+ */
+template<typename T>
+struct ArenaSpan{
+  T *elements;
+  int count;
+
+  T *data() const{ return elements; }
+  int size() const{ return count; }
+  T *begin() const{ return elements; }
+  T *end() const{ return elements + count; }
+  T &operator[](int i) const{ return elements[i]; }
+};
+
+/* Exported constants --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported Classes ----------------------------------------------------------*/
+
+class FrameArena{
+  std::unique_ptr<uint8_t[]> buffer;
+  size_t capacity;
+  size_t used;
+  std::vector<std::unique_ptr<uint8_t[]>> overflow;  //Allocations that didn't fit in the buffer
+  size_t overflow_bytes;
+
+  void *allocate(size_t bytes, size_t alignment);
+public:
+
+  /**
+   * @brief Class constructor. Allocates the buffer of the arena.
+   *
+   * @param[in] capacity Initial size of the buffer in bytes. If a frame needs more, the extra buffers are
+   *                     taken from the heap and the buffer grows to fit them when the arena is reset.
+   */
+  FrameArena(size_t capacity);
+
+  /**
+   * @brief Allocates an uninitialized buffer.
+   *
+   * @param[in] count The number of elements of the buffer.
+   *
+   * @return The buffer. It is valid until the next call to reset().
+   */
+  template<typename T>
+  ArenaSpan<T> alloc(int count){
+    static_assert(std::is_trivial<T>::value, "The arena doesn't construct nor destroy its elements");
+    return {static_cast<T *>(allocate(sizeof(T) * count, alignof(T))), count};
+  }
+
+  /**
+   * @brief Releases all the buffers allocated since the previous reset. Must be called when the frame ends.
+   */
+  void reset();
+
+  /**
+   * @brief Obtain the number of bytes allocated since the previous reset.
+   *
+   * @return The number of bytes.
+   */
+  size_t size_bytes() const;
+
+  /**
+   * @brief Obtain the size of the buffer of the arena.
+   *
+   * @return The number of bytes.
+   */
+  size_t capacity_bytes() const;
+};
+
+/* Exported Functions --------------------------------------------------------*/
+
+#endif /* __FRAME_ARENA_H__ */
@@ -0,0 +1,370 @@
+/**
+  ******************************************************************************
+  * @file   frame_buffer.cpp
+  * @author Pablo San Millán Fierro (pablo.sanmillanf@alumnos.upm.es)
+  * @brief  RGB565 shadow frame buffer Module.
+  *
+  * @note   End-of-degree work.
+  *         This module keeps an in-memory copy of the display contents and
+  *         tracks which regions have changed since the last flush.
+  ******************************************************************************
+*/
+
+/* Includes ------------------------------------------------------------------*/
+#include "frame_buffer.h" // Module header
+#include "../mono_expand/mono_expand.h"
+#include <algorithm>
+
+/* Private defines -----------------------------------------------------------*/
+/* Private typedef -----------------------------------------------------------*/
+/* Private variables----------------------------------------------------------*/
+static const unsigned int max_dirty_rects = 16; //Above this, new rects are merged with the closest one
+static const int max_band_gap = 4;              //Unchanged rows allowed inside one sent region
+/* Private function prototypes -----------------------------------------------*/
+static FB_RECT rect_union(FB_RECT a, FB_RECT b);
+static int rect_area(FB_RECT rect);
+static bool rects_touch(FB_RECT a, FB_RECT b);
+/* Functions -----------------------------------------------------------------*/
+
+/**
+ * @brief Class constructor. Allocates a frame buffer of "width" x "height" pixels filled with 0x0000.
+ *
+ * @param[in] width Width of the frame buffer in pixels.
+ * @param[in] height Height of the frame buffer in pixels.
+ */
+FrameBuffer::FrameBuffer(int width, int height):
+    width(width), height(height), back(width * height, 0x0000), front(width * height, 0x0000), invalidated(true){
+  dirty.reserve(max_dirty_rects);
+}
+
+
+/**
+ * @brief Fills a region with an uniform color. The region is clipped to the frame buffer bounds.
+ *
+ * @param[in] start_x X coordinate of the top left corner of the region.
+ * @param[in] start_y Y coordinate of the top left corner of the region.
+ * @param[in] end_x X coordinate of the bottom right corner of the region (not included).
+ * @param[in] end_y Y coordinate of the bottom right corner of the region (not included).
+ * @param[in] color Color of the region in the same byte order used in the SPI messages.
+ */
+void FrameBuffer::fill(int start_x, int start_y, int end_x, int end_y, uint16_t color){
+  FB_RECT rect = {start_x, start_y, end_x, end_y};
+
+  if(!clip(&rect))
+    return;
+
+  for(int y = rect.start_y; y < rect.end_y; y++){
+    std::fill(
+        back.begin() + y * width + rect.start_x,
+        back.begin() + y * width + rect.end_x,
+        color);
+  }
+  add_dirty(rect);
+}
+
+
+/**
+ * @brief Copies a bitmap into the frame buffer without modifying its colors. The bitmap is clipped
+ *        to the frame buffer bounds.
+ *
+ * @param[in] start_x X coordinate of the top left corner of the bounding box containing the bitmap.
+ * @param[in] start_y Y coordinate of the top left corner of the bounding box containing the bitmap.
+ * @param[in] bitmap_width Width of the bitmap in pixels.
+ * @param[in] bit_map Pixels of the bitmap.
+ * @param[in] size Number of pixels of the bitmap.
+ */
+void FrameBuffer::blit(int start_x, int start_y, int bitmap_width, const uint16_t bit_map[], int size){
+  if(bitmap_width <= 0)
+    return;
+
+  FB_RECT rect = {start_x, start_y, start_x + bitmap_width, start_y + size / bitmap_width};
+
+  if(!clip(&rect))
+    return;
+
+  for(int y = rect.start_y; y < rect.end_y; y++){
+    const uint16_t *src = bit_map + (y - start_y) * bitmap_width + (rect.start_x - start_x);
+    std::copy(src, src + (rect.end_x - rect.start_x), back.begin() + y * width + rect.start_x);
+  }
+  add_dirty(rect);
+}
+
+
+/**
+ * @brief Copies a 1 bit per pixel bitmap into the frame buffer. Set bits take the "color" color and
+ *        cleared bits take the "background" color. The bitmap is clipped to the frame buffer bounds.
+ *
+ * @param[in] start_x X coordinate of the top left corner of the bounding box containing the bitmap.
+ * @param[in] start_y Y coordinate of the top left corner of the bounding box containing the bitmap.
+ * @param[in] bitmap_width Width of the bitmap in pixels.
+ * @param[in] bit_map Bits of the bitmap. Rows are padded to a whole byte and the MSB is the leftmost pixel.
+ * @param[in] size Number of bytes of the bitmap.
+ * @param[in] color Color of the set bits.
+ * @param[in] background Color of the cleared bits.
+ */
+void FrameBuffer::blit_mono(int start_x, int start_y, int bitmap_width, const uint8_t bit_map[], int size,
+    uint16_t color, uint16_t background){
+  if(bitmap_width <= 0)
+    return;
+
+  int stride = (bitmap_width + 7) / 8;
+  FB_RECT rect = {start_x, start_y, start_x + bitmap_width, start_y + size / stride};
+
+  if(!clip(&rect))
+    return;
+
+  for(int y = rect.start_y; y < rect.end_y; y++){
+    const uint8_t *src = bit_map + (y - start_y) * stride;
+    uint16_t *dst = back.data() + y * width;
+
+    MonoExpand::expand(src, rect.start_x - start_x, rect.end_x - rect.start_x, color, background,
+        dst + rect.start_x);
+  }
+  add_dirty(rect);
+}
+
+
+/**
+ * @brief Moves the contents of a region "columns" pixels to the left. The leftmost columns of the region are
+ *        lost and the rightmost "columns" columns keep their previous contents, so the caller can draw the new
+ *        ones there. The region is clipped to the frame buffer bounds.
+ *
+ * @param[in] start_x X coordinate of the top left corner of the region.
+ * @param[in] start_y Y coordinate of the top left corner of the region.
+ * @param[in] end_x X coordinate of the bottom right corner of the region (not included).
+ * @param[in] end_y Y coordinate of the bottom right corner of the region (not included).
+ * @param[in] columns The number of columns moved.
+ */
+void FrameBuffer::scroll_left(int start_x, int start_y, int end_x, int end_y, int columns){
+  FB_RECT rect = {start_x, start_y, end_x, end_y};
+
+  if(!clip(&rect) || columns <= 0 || columns >= rect.end_x - rect.start_x)
+    return;
+
+  for(int y = rect.start_y; y < rect.end_y; y++){
+    uint16_t *row = back.data() + y * width;
+    std::copy(row + rect.start_x + columns, row + rect.end_x, row + rect.start_x);
+  }
+  add_dirty({rect.start_x, rect.start_y, rect.end_x - columns, rect.end_y});
+}
+
+
+/**
+ * @brief Packs the whole rendered contents as a bitmap, so they can be drawn again later with blit_mono()
+ *        taking 1 bit per pixel instead of a full copy. It fails if a pixel is neither color nor background.
+ *
+ * @param[out] bit_map Where the bits are packed. It is resized to height rows of (width + 7) / 8 bytes, the
+ *                     MSB being the leftmost pixel. Pixels equal to color are set.
+ * @param[in] color Color of the set bits.
+ * @param[in] background Color of the cleared bits.
+ * @return True if the contents only have both colors, false otherwise (bit_map is left empty).
+ */
+bool FrameBuffer::snapshot_mono(std::vector<uint8_t> *bit_map, uint16_t color, uint16_t background) const{
+  int stride = (width + 7) / 8;
+
+  bit_map->assign(stride * height, 0);
+  for(int y = 0; y < height; y++){
+    const uint16_t *row = back.data() + y * width;
+    uint8_t *bits = bit_map->data() + y * stride;
+
+    for(int x = 0; x < width; x++){
+      if(row[x] == color && color != background)
+        bits[x / 8] |= 0x80 >> (x % 8);
+      else if(row[x] != background){
+        bit_map->clear();
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+
+/**
+ * @brief Forgets the panel contents, so the next call to take_dirty_regions() will return the whole
+ *        frame buffer.
+ */
+void FrameBuffer::invalidate(){
+  invalidated = true;
+}
+
+
+/**
+ * @brief Obtains the regions that differ between the rendered contents and the panel contents and
+ *        marks them as sent. Each dirty rectangle is shrunk to the rows and columns that really
+ *        changed, so drawing the same pixels twice in a frame produces no traffic.
+ *
+ * @param[out] regions The list of regions that must be sent to the panel. Its previous contents are
+ *                     replaced, reusing its memory.
+ */
+void FrameBuffer::take_dirty_regions(std::vector<FB_RECT> *regions){
+  regions->clear();
+
+  if(invalidated){
+    invalidated = false;
+    dirty.clear();
+    front = back;
+    regions->push_back({0, 0, width, height});
+    return;
+  }
+
+  for(FB_RECT rect : dirty)
+    tighten(rect, regions);
+  dirty.clear();
+}
+
+
+/**
+ * @brief Obtains a pointer to the first pixel of a row of the rendered contents.
+ *
+ * @param[in] y The row.
+ *
+ * @return The pointer to the pixel (0, y).
+ */
+const uint16_t *FrameBuffer::row(int y) const{
+  return back.data() + y * width;
+}
+
+
+/**
+ * @brief Obtains a pointer to the first pixel of a row of the panel contents. The pixels of the regions
+ *        returned by take_dirty_regions() don't change until it is called again, so they can be sent to
+ *        the panel while the next frame is rendered.
+ *
+ * @param[in] y The row.
+ *
+ * @return The pointer to the pixel (0, y).
+ */
+const uint16_t *FrameBuffer::panel_row(int y) const{
+  return front.data() + y * width;
+}
+
+
+/* Private functions ---------------------------------------------------------*/
+/**
+ * @brief Adds a rectangle to the dirty list. Rectangles that overlap or touch an existing one are merged
+ *        with it. If the list is full, the rectangle is merged with the one that grows the least.
+ *
+ * @param[in] rect The already clipped rectangle.
+ */
+void FrameBuffer::add_dirty(FB_RECT rect){
+  bool merged;
+
+  do{
+    merged = false;
+    for(auto it = dirty.begin(); it != dirty.end(); it++){
+      if(rects_touch(*it, rect)){
+        rect = rect_union(*it, rect);
+        dirty.erase(it);
+        merged = true;
+        break;
+      }
+    }
+  }while(merged);
+
+  if(dirty.size() < max_dirty_rects){
+    dirty.push_back(rect);
+    return;
+  }
+
+  auto best = dirty.begin();
+  int best_growth = rect_area(rect_union(*best, rect)) - rect_area(*best);
+  for(auto it = dirty.begin() + 1; it != dirty.end(); it++){
+    int growth = rect_area(rect_union(*it, rect)) - rect_area(*it);
+    if(growth < best_growth){
+      best_growth = growth;
+      best = it;
+    }
+  }
+  *best = rect_union(*best, rect);
+}
+
+
+/**
+ * @brief Clips a rectangle to the frame buffer bounds.
+ *
+ * @param[inout] rect The rectangle to clip.
+ *
+ * @return False if the resulting rectangle is empty, true otherwise.
+ */
+bool FrameBuffer::clip(FB_RECT *rect){
+  rect->start_x = std::max(rect->start_x, 0);
+  rect->start_y = std::max(rect->start_y, 0);
+  rect->end_x = std::min(rect->end_x, width);
+  rect->end_y = std::min(rect->end_y, height);
+
+  return rect->start_x < rect->end_x && rect->start_y < rect->end_y;
+}
+
+
+/**
+ * @brief Compares a dirty rectangle between the rendered and the panel contents and appends to "regions"
+ *        the bands of rows that really changed, each one limited to its changed columns. The compared
+ *        area is copied to the panel contents.
+ *
+ * @param[in] rect The dirty rectangle.
+ * @param[out] regions The list where the changed regions are appended.
+ */
+void FrameBuffer::tighten(FB_RECT rect, std::vector<FB_RECT> *regions){
+  FB_RECT band = {0, 0, 0, 0};
+  bool in_band = false;
+  int row_width = rect.end_x - rect.start_x;
+
+  for(int y = rect.start_y; y < rect.end_y; y++){
+    uint16_t *b = back.data() + y * width + rect.start_x;
+    uint16_t *f = front.data() + y * width + rect.start_x;
+
+    auto first = std::mismatch(b, b + row_width, f);
+    if(first.first == b + row_width){
+      if(in_band && y - band.end_y >= max_band_gap){
+        regions->push_back(band);
+        in_band = false;
+      }
+      continue;
+    }
+
+    int left = first.first - b, right = row_width;
+    while(b[right - 1] == f[right - 1])
+      right--;
+
+    std::copy(b + left, b + right, f + left);
+
+    if(!in_band){
+      band = {rect.start_x + left, y, rect.start_x + right, y + 1};
+      in_band = true;
+    }
+    else{
+      band.start_x = std::min(band.start_x, rect.start_x + left);
+      band.end_x = std::max(band.end_x, rect.start_x + right);
+      band.end_y = y + 1;
+    }
+  }
+
+  if(in_band)
+    regions->push_back(band);
+}
+
+
+/**
+ * @brief Obtains the smallest rectangle that contains both rectangles.
+ */
+static FB_RECT rect_union(FB_RECT a, FB_RECT b){
+  return {std::min(a.start_x, b.start_x), std::min(a.start_y, b.start_y),
+          std::max(a.end_x, b.end_x), std::max(a.end_y, b.end_y)};
+}
+
+
+/**
+ * @brief Obtains the number of pixels of a rectangle.
+ */
+static int rect_area(FB_RECT rect){
+  return (rect.end_x - rect.start_x) * (rect.end_y - rect.start_y);
+}
+
+
+/**
+ * @brief Checks if two rectangles overlap or share an edge.
+ */
+static bool rects_touch(FB_RECT a, FB_RECT b){
+  return a.start_x <= b.end_x && b.start_x <= a.end_x && a.start_y <= b.end_y && b.start_y <= a.end_y;
+}
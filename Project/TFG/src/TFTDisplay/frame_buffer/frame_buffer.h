@@ -0,0 +1,189 @@
+/**
+  ******************************************************************************
+  * @file   frame_buffer.h
+  * @author Pablo San Millán Fierro (pablo.sanmillanf@alumnos.upm.es)
+  * @brief  RGB565 shadow frame buffer Module Header.
+  *
+  * @note   End-of-degree work.
+  *         This module keeps an in-memory copy of the display contents and
+  *         tracks which regions have changed since the last flush.
+  ******************************************************************************
+*/
+
+#ifndef __FRAME_BUFFER_H__
+#define __FRAME_BUFFER_H__
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <vector>
+
+//The pixels are stored in memory in the order they are sent to the panel (RGB565 high byte first), so the
+//rows can be handed to the SPI layer without converting them. The colors are built as color[0] | color[1] << 8,
+//which only gives that order in little-endian CPUs.
+static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__, "The frame buffer pixels must be in the panel byte order");
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+ * Rectangular region of the frame buffer. The start coordinates are inclusive and the end
+ * coordinates are exclusive, the same convention used by Display_driver::reset_region.
+ */
+typedef struct{
+  int start_x;
+  int start_y;
+  int end_x;
+  int end_y;
+}FB_RECT;
+
+/* Exported constants --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported Classes ----------------------------------------------------------*/
+
+class FrameBuffer{
+  int width;
+  int height;
+  std::vector<uint16_t> back;   //Contents rendered by the draw calls
+  std::vector<uint16_t> front;  //Contents that the panel is currently showing
+  std::vector<FB_RECT> dirty;
+  bool invalidated;
+
+  void add_dirty(FB_RECT rect);
+  bool clip(FB_RECT *rect);
+  void tighten(FB_RECT rect, std::vector<FB_RECT> *regions);
+public:
+
+  /**
+   * @brief Class constructor. Allocates a frame buffer of "width" x "height" pixels filled with 0x0000.
+   *
+   * @param[in] width Width of the frame buffer in pixels.
+   * @param[in] height Height of the frame buffer in pixels.
+   */
+  FrameBuffer(int width, int height);
+
+  /**
+   * @brief Fills a region with an uniform color. The region is clipped to the frame buffer bounds.
+   *
+   * @param[in] start_x X coordinate of the top left corner of the region.
+   * @param[in] start_y Y coordinate of the top left corner of the region.
+   * @param[in] end_x X coordinate of the bottom right corner of the region (not included).
+   * @param[in] end_y Y coordinate of the bottom right corner of the region (not included).
+   * @param[in] color Color of the region in the same byte order used in the SPI messages.
+   */
+  void fill(int start_x, int start_y, int end_x, int end_y, uint16_t color);
+
+  /**
+   * @brief Copies a bitmap into the frame buffer without modifying its colors. The bitmap is clipped
+   *        to the frame buffer bounds.
+   *
+   * @param[in] start_x X coordinate of the top left corner of the bounding box containing the bitmap.
+   * @param[in] start_y Y coordinate of the top left corner of the bounding box containing the bitmap.
+   * @param[in] bitmap_width Width of the bitmap in pixels.
+   * @param[in] bit_map Pixels of the bitmap.
+   * @param[in] size Number of pixels of the bitmap.
+   */
+  void blit(int start_x, int start_y, int bitmap_width, const uint16_t bit_map[], int size);
+
+  /**
+   * @brief Copies a 1 bit per pixel bitmap into the frame buffer. Set bits take the "color" color and
+   *        cleared bits take the "background" color. The bitmap is clipped to the frame buffer bounds.
+   *
+   * @param[in] start_x X coordinate of the top left corner of the bounding box containing the bitmap.
+   * @param[in] start_y Y coordinate of the top left corner of the bounding box containing the bitmap.
+   * @param[in] bitmap_width Width of the bitmap in pixels.
+   * @param[in] bit_map Bits of the bitmap. Rows are padded to a whole byte and the MSB is the leftmost pixel.
+   * @param[in] size Number of bytes of the bitmap.
+   * @param[in] color Color of the set bits.
+   * @param[in] background Color of the cleared bits.
+   */
+  void blit_mono(int start_x, int start_y, int bitmap_width, const uint8_t bit_map[], int size,
+      uint16_t color, uint16_t background);
+
+  /**
+   * @brief Moves the contents of a region "columns" pixels to the left. The leftmost columns of the region are
+   *        lost and the rightmost "columns" columns keep their previous contents, so the caller can draw the new
+   *        ones there. The region is clipped to the frame buffer bounds.
+   *
+   * @param[in] start_x X coordinate of the top left corner of the region.
+   * @param[in] start_y Y coordinate of the top left corner of the region.
+   * @param[in] end_x X coordinate of the bottom right corner of the region (not included).
+   * @param[in] end_y Y coordinate of the bottom right corner of the region (not included).
+   * @param[in] columns The number of columns moved.
+   */
+  void scroll_left(int start_x, int start_y, int end_x, int end_y, int columns);
+
+  /**
+   * @brief Renders a region directly into the frame buffer, one row at a time. The region is clipped to the
+   *        frame buffer bounds and "render_row" is called for every visible row as
+   *        render_row(row, first_column, end_column, pixels), with the row and the columns relative to the
+   *        region. It must write the pixels [first_column, end_column) of that row of the region in "pixels".
+   *
+   * @param[in] start_x X coordinate of the top left corner of the region.
+   * @param[in] start_y Y coordinate of the top left corner of the region.
+   * @param[in] end_x X coordinate of the bottom right corner of the region (not included).
+   * @param[in] end_y Y coordinate of the bottom right corner of the region (not included).
+   * @param[in] render_row The function that renders the rows.
+   */
+  template<typename RowRenderer>
+  void render_rows(int start_x, int start_y, int end_x, int end_y, RowRenderer render_row){
+    FB_RECT rect = {start_x, start_y, end_x, end_y};
+
+    if(!clip(&rect))
+      return;
+
+    for(int y = rect.start_y; y < rect.end_y; y++)
+      render_row(y - start_y, rect.start_x - start_x, rect.end_x - start_x, back.data() + y * width + rect.start_x);
+    add_dirty(rect);
+  }
+
+  /**
+   * @brief Packs the whole rendered contents as a bitmap, so they can be drawn again later with blit_mono()
+   *        taking 1 bit per pixel instead of a full copy. It fails if a pixel is neither color nor background.
+   *
+   * @param[out] bit_map Where the bits are packed. It is resized to height rows of (width + 7) / 8 bytes, the
+   *                     MSB being the leftmost pixel. Pixels equal to color are set.
+   * @param[in] color Color of the set bits.
+   * @param[in] background Color of the cleared bits.
+   * @return True if the contents only have both colors, false otherwise (bit_map is left empty).
+   */
+  bool snapshot_mono(std::vector<uint8_t> *bit_map, uint16_t color, uint16_t background) const;
+
+  /**
+   * @brief Forgets the panel contents, so the next call to take_dirty_regions() will return the whole
+   *        frame buffer.
+   */
+  void invalidate();
+
+  /**
+   * @brief Obtains the regions that differ between the rendered contents and the panel contents and
+   *        marks them as sent. Each dirty rectangle is shrunk to the rows and columns that really
+   *        changed, so drawing the same pixels twice in a frame produces no traffic.
+   *
+   * @param[out] regions The list of regions that must be sent to the panel. Its previous contents are
+   *                     replaced, reusing its memory.
+   */
+  void take_dirty_regions(std::vector<FB_RECT> *regions);
+
+  /**
+   * @brief Obtains a pointer to the first pixel of a row of the rendered contents.
+   *
+   * @param[in] y The row.
+   *
+   * @return The pointer to the pixel (0, y).
+   */
+  const uint16_t *row(int y) const;
+
+  /**
+   * @brief Obtains a pointer to the first pixel of a row of the panel contents. The pixels of the regions
+   *        returned by take_dirty_regions() don't change until it is called again, so they can be sent to
+   *        the panel while the next frame is rendered.
+   *
+   * @param[in] y The row.
+   *
+   * @return The pointer to the pixel (0, y).
+   */
+  const uint16_t *panel_row(int y) const;
+};
+
+/* Exported Functions --------------------------------------------------------*/
+
+#endif /* __FRAME_BUFFER_H__ */
@@ -0,0 +1,353 @@
+/**
+  ******************************************************************************
+  * @file   headless_transport.cpp
+  * @author Pablo San Millán Fierro (pablo.sanmillanf@alumnos.upm.es)
+  * @brief  Headless display transport Module.
+  *
+  * @note   End-of-degree work.
+  *         This module interprets the ST7789 command stream generated by
+  *         Display_driver into an in-memory frame buffer instead of sending
+  *         it to a panel, so the display code can run and be checked on a
+  *         machine without the panel attached.
+  ******************************************************************************
+*/
+
+/* Includes ------------------------------------------------------------------*/
+#include "headless_transport.h" // Module header
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <algorithm>
+
+/* Private defines -----------------------------------------------------------*/
+/* Private typedef -----------------------------------------------------------*/
+/* Private variables----------------------------------------------------------*/
+static const uint8_t swreset_cmd = 0x01;
+static const uint8_t slpin_cmd = 0x10;
+static const uint8_t slpout_cmd = 0x11;
+static const uint8_t invoff_cmd = 0x20;
+static const uint8_t invon_cmd = 0x21;
+static const uint8_t dispoff_cmd = 0x28;
+static const uint8_t dispon_cmd = 0x29;
+static const uint8_t caset_cmd = 0x2A;
+static const uint8_t raset_cmd = 0x2B;
+static const uint8_t ramwr_cmd = 0x2C;
+static const uint8_t madctl_cmd = 0x36;
+static const uint8_t ramwrc_cmd = 0x3C;
+
+static const uint8_t madctl_my = 0x80;   //Row address order
+static const uint8_t madctl_mx = 0x40;   //Column address order
+static const uint8_t madctl_mv = 0x20;   //Row/column exchange
+
+static const int max_transfer_size = 4096;  //Same as the spidev default "bufsiz"
+static const int memory_rows = 320;         //Rows of the ST7789 frame memory. The panel shows the first ones.
+/* Private function prototypes -----------------------------------------------*/
+/* Functions -----------------------------------------------------------------*/
+
+/**
+ * @brief Class constructor. Creates a panel of "width" x "height" pixels filled with 0x0000.
+ *
+ * @param[in] width Width of the panel in pixels.
+ * @param[in] height Height of the panel in pixels.
+ */
+HeadlessTransport::HeadlessTransport(int width, int height):
+    width(width), height(height), pixels(width * height, 0x0000){
+  reset();
+}
+
+
+/**
+ * @brief Nothing to prepare, the panel is always available.
+ *
+ * @return 0.
+ */
+int HeadlessTransport::start(){
+  return 0;
+}
+
+
+/**
+ * @brief Interprets a block of bytes. The delay is ignored.
+ *
+ * @param[in] data The bytes.
+ * @param[in] size The number of bytes.
+ * @param[in] cmd If true, the bytes are commands, if false, they are normal data.
+ * @param[in] delay Ignored.
+ */
+void HeadlessTransport::send(const uint8_t data[], int size, uint8_t cmd, int delay){
+  process(data, size, cmd);
+}
+
+
+/**
+ * @brief Interprets a group of data blocks.
+ *
+ * @param[in] segments The data blocks, in order.
+ * @param[in] count The number of blocks.
+ * @param[in] cmd If true, the bytes are commands, if false, they are normal data.
+ *
+ * @return 0.
+ */
+int HeadlessTransport::send_segments(const SPI_SEGMENT segments[], int count, uint8_t cmd){
+  for(int i = 0; i < count; i++)
+    process(segments[i].data, segments[i].size, cmd);
+
+  return 0;
+}
+
+
+/**
+ * @brief Interprets the same pattern "repetitions" times.
+ *
+ * @param[in] pattern The bytes to repeat.
+ * @param[in] pattern_size The number of bytes of the pattern.
+ * @param[in] repetitions The number of times the pattern is interpreted.
+ * @param[in] cmd If true, the bytes are commands, if false, they are normal data.
+ *
+ * @return 0 if success, -1 if error.
+ */
+int HeadlessTransport::send_fill(const uint8_t pattern[], int pattern_size, long repetitions, uint8_t cmd){
+  if(pattern_size <= 0)
+    return -1;
+
+  for(long i = 0; i < repetitions; i++)
+    process(pattern, pattern_size, cmd);
+
+  return 0;
+}
+
+
+/**
+ * @brief Obtain the maximum number of bytes that should be passed to send_segments at once. There is no
+ *        real limit, so the spidev default is used to make the driver behave as in the target.
+ *
+ * @return The maximum number of bytes.
+ */
+int HeadlessTransport::get_max_transfer_size(){
+  return max_transfer_size;
+}
+
+
+/**
+ * @brief Nothing to free. The panel contents are kept so they can be read after the driver ends.
+ *
+ * @return 0.
+ */
+int HeadlessTransport::end(){
+  return 0;
+}
+
+
+/**
+ * @brief Obtain the color of a pixel of the panel.
+ *
+ * @param[in] x The column.
+ * @param[in] y The row.
+ *
+ * @return The RGB565 color, or 0 if the pixel is out of the panel.
+ */
+uint16_t HeadlessTransport::get_pixel(int x, int y) const{
+  if(x < 0 || x >= width || y < 0 || y >= height)
+    return 0;
+
+  return pixels[y * width + x];
+}
+
+
+/**
+ * @brief Obtain the whole panel contents.
+ *
+ * @return The RGB565 color of every pixel, row after row.
+ */
+const std::vector<uint16_t> &HeadlessTransport::get_pixels() const{
+  return pixels;
+}
+
+
+/**
+ * @brief Checks if the panel would be showing its contents: out of sleep mode and with the display on.
+ *
+ * @return True if the panel is showing its contents.
+ */
+bool HeadlessTransport::is_showing() const{
+  return !sleeping && display_on;
+}
+
+
+/**
+ * @brief Writes the panel contents into a binary PPM (P6) image file.
+ *
+ * @param[in] path The path of the image file.
+ *
+ * @return 0 if success, -1 if error.
+ */
+int HeadlessTransport::dump_ppm(const char *path) const{
+  FILE *file = fopen(path, "wb");
+
+  if(file == NULL){
+    fprintf(stderr, "ERROR: Couldn't open %s. Error description: %s\n", path, strerror(errno));
+    return -1;
+  }
+
+  std::vector<uint8_t> rgb(pixels.size() * 3);
+  for(size_t i = 0; i < pixels.size(); i++){
+    uint8_t r = pixels[i] >> 11, g = (pixels[i] >> 5) & 0x3F, b = pixels[i] & 0x1F;
+    rgb[3*i] = (r << 3) | (r >> 2);
+    rgb[3*i + 1] = (g << 2) | (g >> 4);
+    rgb[3*i + 2] = (b << 3) | (b >> 2);
+  }
+
+  fprintf(file, "P6\n%d %d\n255\n", width, height);
+  size_t written = fwrite(rgb.data(), 1, rgb.size(), file);
+
+  if(fclose(file) != 0 || written != rgb.size()){
+    fprintf(stderr, "ERROR: Couldn't write %s. Error description: %s\n", path, strerror(errno));
+    return -1;
+  }
+  return 0;
+}
+
+
+/* Private functions ---------------------------------------------------------*/
+/**
+ * @brief Sets the state of the panel after a reset. The memory contents are not modified.
+ */
+void HeadlessTransport::reset(){
+  command = 0x00;
+  param_index = 0;
+  col_start = row_start = 0;
+  col_end = width - 1;
+  row_end = height - 1;
+  col = row = 0;
+  writing = false;
+  high_byte_pending = false;
+  high_byte = 0;
+  madctl = 0x00;
+  sleeping = true;
+  display_on = false;
+  inverted = false;
+}
+
+
+/**
+ * @brief Interprets a block of bytes.
+ *
+ * @param[in] data The bytes.
+ * @param[in] size The number of bytes.
+ * @param[in] cmd If true, the bytes are commands, if false, they are normal data.
+ */
+void HeadlessTransport::process(const uint8_t data[], int size, uint8_t cmd){
+  for(int i = 0; i < size; i++){
+    if(cmd)
+      process_command(data[i]);
+    else
+      process_data(data[i]);
+  }
+}
+
+
+/**
+ * @brief Interprets a command byte.
+ *
+ * @param[in] byte The command.
+ */
+void HeadlessTransport::process_command(uint8_t byte){
+  command = byte;
+  param_index = 0;
+  writing = false;
+  high_byte_pending = false;
+
+  switch(byte){
+    case swreset_cmd:
+      reset();
+      break;
+    case slpin_cmd:
+      sleeping = true;
+      break;
+    case slpout_cmd:
+      sleeping = false;
+      break;
+    case invoff_cmd:
+      inverted = false;
+      break;
+    case invon_cmd:
+      inverted = true;
+      break;
+    case dispoff_cmd:
+      display_on = false;
+      break;
+    case dispon_cmd:
+      display_on = true;
+      break;
+    case ramwr_cmd:
+      col = col_start;
+      row = row_start;
+      writing = true;
+      break;
+    case ramwrc_cmd:
+      writing = true;
+      break;
+  }
+}
+
+
+/**
+ * @brief Interprets a data byte: a parameter of the last command or half of a pixel.
+ *
+ * @param[in] byte The data.
+ */
+void HeadlessTransport::process_data(uint8_t byte){
+  if(writing){
+    if(!high_byte_pending){
+      high_byte = byte;
+      high_byte_pending = true;
+    }
+    else{
+      high_byte_pending = false;
+      write_pixel((high_byte << 8) | byte);
+    }
+    return;
+  }
+
+  if(param_index < (int)sizeof(params))
+    params[param_index] = byte;
+  param_index++;
+
+  if(command == madctl_cmd && param_index == 1)
+    madctl = byte;
+  else if(command == caset_cmd && param_index == 4){
+    col_start = (params[0] << 8) | params[1];
+    col_end = (params[2] << 8) | params[3];
+  }
+  else if(command == raset_cmd && param_index == 4){
+    row_start = (params[0] << 8) | params[1];
+    row_end = (params[2] << 8) | params[3];
+  }
+}
+
+
+/**
+ * @brief Stores a pixel of a memory write and moves to the next one. The write goes column after column
+ *        inside the window and wraps around at its end. Pixels out of the panel are discarded.
+ *
+ * @param[in] pixel The RGB565 color.
+ */
+void HeadlessTransport::write_pixel(uint16_t pixel){
+  int x = col, y = row;
+
+  if(madctl & madctl_mv)
+    std::swap(x, y);
+  if(madctl & madctl_mx)
+    x = width - 1 - x;
+  if(madctl & madctl_my)
+    y = memory_rows - 1 - y;
+
+  if(x >= 0 && x < width && y >= 0 && y < height)
+    pixels[y * width + x] = pixel;
+
+  if(++col > col_end){
+    col = col_start;
+    if(++row > row_end)
+      row = row_start;
+  }
+}
@@ -0,0 +1,112 @@
+/**
+  ******************************************************************************
+  * @file   headless_transport.h
+  * @author Pablo San Millán Fierro (pablo.sanmillanf@alumnos.upm.es)
+  * @brief  Headless display transport Module Header.
+  *
+  * @note   End-of-degree work.
+  *         This module interprets the ST7789 command stream generated by
+  *         Display_driver into an in-memory frame buffer instead of sending
+  *         it to a panel, so the display code can run and be checked on a
+  *         machine without the panel attached.
+  ******************************************************************************
+*/
+
+#ifndef __HEADLESS_TRANSPORT_H__
+#define __HEADLESS_TRANSPORT_H__
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <vector>
+#include "../display_transport/display_transport.h"
+
+/* Exported types ------------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported Classes ----------------------------------------------------------*/
+
+/**
+ * Transport that emulates an ST7789 panel. It understands the commands used by Display_driver: CASET,
+ * RASET, RAMWR, RAMWRC, MADCTL (row/column exchange and mirroring inside the 240x320 frame memory, whose
+ * first rows are the panel), COLMOD, SWRESET,
+ * SLPIN/SLPOUT, DISPON/DISPOFF and INVON/INVOFF. Pixels are always interpreted as RGB565 and stored as
+ * they are written; the inversion state is kept but not applied, like the panel of this project, that
+ * needs INVON to show the expected colors.
+ */
+class HeadlessTransport: public DisplayTransport{
+  int width;
+  int height;
+  std::vector<uint16_t> pixels;   //RGB565 value of every pixel, row after row
+
+  uint8_t command;                //Last command received
+  int param_index;                //Number of parameters of the last command received
+  uint8_t params[4];
+  int col_start, col_end, row_start, row_end;
+  int col, row;                   //Next pixel of the memory write
+  bool writing;                   //True after RAMWR or RAMWRC
+  bool high_byte_pending;         //True if the first byte of a pixel has been received
+  uint8_t high_byte;
+  uint8_t madctl;
+  bool sleeping;
+  bool display_on;
+  bool inverted;
+
+  void reset();
+  void process(const uint8_t data[], int size, uint8_t cmd);
+  void process_command(uint8_t byte);
+  void process_data(uint8_t byte);
+  void write_pixel(uint16_t pixel);
+public:
+
+  /**
+   * @brief Class constructor. Creates a panel of "width" x "height" pixels filled with 0x0000.
+   *
+   * @param[in] width Width of the panel in pixels.
+   * @param[in] height Height of the panel in pixels.
+   */
+  HeadlessTransport(int width, int height);
+
+  int start() override;
+  void send(const uint8_t data[], int size, uint8_t cmd, int delay) override;
+  int send_segments(const SPI_SEGMENT segments[], int count, uint8_t cmd) override;
+  int send_fill(const uint8_t pattern[], int pattern_size, long repetitions, uint8_t cmd) override;
+  int get_max_transfer_size() override;
+  int end() override;
+
+  /**
+   * @brief Obtain the color of a pixel of the panel.
+   *
+   * @param[in] x The column.
+   * @param[in] y The row.
+   *
+   * @return The RGB565 color, or 0 if the pixel is out of the panel.
+   */
+  uint16_t get_pixel(int x, int y) const;
+
+  /**
+   * @brief Obtain the whole panel contents.
+   *
+   * @return The RGB565 color of every pixel, row after row.
+   */
+  const std::vector<uint16_t> &get_pixels() const;
+
+  /**
+   * @brief Checks if the panel would be showing its contents: out of sleep mode and with the display on.
+   *
+   * @return True if the panel is showing its contents.
+   */
+  bool is_showing() const;
+
+  /**
+   * @brief Writes the panel contents into a binary PPM (P6) image file.
+   *
+   * @param[in] path The path of the image file.
+   *
+   * @return 0 if success, -1 if error.
+   */
+  int dump_ppm(const char *path) const;
+};
+
+/* Exported Functions --------------------------------------------------------*/
+
+#endif /* __HEADLESS_TRANSPORT_H__ */
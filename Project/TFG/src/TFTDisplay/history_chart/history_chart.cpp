@@ -0,0 +1,186 @@
+/**
+  ******************************************************************************
+  * @file   history_chart.cpp
+  * @author Pablo San Millán Fierro (pablo.sanmillanf@alumnos.upm.es)
+  * @brief  Scrolling history chart Module.
+  *
+  * @note   End-of-degree work.
+  *         This module draws the recent history of a measure as a line
+  *         chart whose newest sample is in the rightmost column. When new
+  *         samples arrive, the chart is moved to the left and only the new
+  *         columns are drawn.
+  ******************************************************************************
+*/
+
+/* Includes ------------------------------------------------------------------*/
+#include "history_chart.h" // Module header
+#include "../display_driver/display_driver.h"
+#include <algorithm>
+#include <cmath>
+
+/* Private defines -----------------------------------------------------------*/
+#define SCALE_MARGIN     1.5f   //Span of a new scale relative to the span of the samples
+#define MAX_SCALE_SLACK  3.0f   //The scale is adjusted when it is this times larger than needed
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private variables----------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+/* Functions -----------------------------------------------------------------*/
+
+/**
+ * @brief Class constructor. Sets the place of the chart. Each column of the chart shows one sample.
+ *
+ * @param[in] start_x X coordinate of the top left corner of the chart.
+ * @param[in] start_y Y coordinate of the top left corner of the chart.
+ * @param[in] width Width of the chart in pixels, i.e. the number of samples shown.
+ * @param[in] height Height of the chart in pixels.
+ */
+HistoryChart::HistoryChart(int start_x, int start_y, int width, int height):
+    start_x(start_x), start_y(start_y), width(width), height(height), valid(false), sequence(0), scale_min(0),
+    scale_max(0), color(0), background(0){
+}
+
+
+/**
+ * @brief Draws the last samples of a history. If the chart is already in the Display with the same colors and
+ *        the new samples fit in its scale, the chart is moved to the left as many columns as new samples there
+ *        are and only the new columns are drawn. Otherwise the scale is adjusted to the samples and the whole
+ *        chart is drawn.
+ *
+ * @param[in] display The Display where the chart is.
+ * @param[in] samples The samples, from the oldest to the newest.
+ * @param[in] sequence The number of samples added to the history since its start, as returned by
+ *                     MeasureHistory::get_samples. It tells how many samples are new since the last draw.
+ * @param[in] min_span The minimum difference between the values of the top and bottom rows, so the noise of
+ *                     a stable measure isn't magnified.
+ * @param[in] color Color of the line.
+ * @param[in] background_color Color of the rest of the chart.
+ */
+void HistoryChart::draw(Display_driver &display, const std::vector<float> &samples, long sequence, float min_span,
+    uint8_t color[], uint8_t background_color[]){
+  uint16_t color16 = color[0] | (color[1] << 8);
+  uint16_t background16 = background_color[0] | (background_color[1] << 8);
+  long new_samples = sequence - this->sequence;
+  bool same_scale = !fit_scale(samples, min_span);
+
+  if(valid && same_scale && color16 == this->color && background16 == background &&
+      new_samples >= 0 && new_samples < width){
+    this->sequence = sequence;
+    if(new_samples > 0){
+      display.scroll_region_left(start_x, start_y, start_x + width, start_y + height, new_samples);
+      draw_columns(display, samples, width - new_samples, width, color);
+    }
+    return;
+  }
+
+  valid = true;
+  this->sequence = sequence;
+  this->color = color16;
+  background = background16;
+
+  display.reset_region(start_x, start_y, start_x + width, start_y + height, background_color);
+  draw_columns(display, samples, 0, width, color);
+}
+
+
+/**
+ * @brief Obtain the value of the bottom row of the chart.
+ *
+ * @return The value.
+ */
+float HistoryChart::get_scale_min() const{
+  return scale_min;
+}
+
+
+/**
+ * @brief Obtain the value of the top row of the chart.
+ *
+ * @return The value.
+ */
+float HistoryChart::get_scale_max() const{
+  return scale_max;
+}
+
+
+/**
+ * @brief Forgets the drawn chart, so the next draw redraws it completely. Must be called when something
+ *        else is drawn over the chart, e.g. when the screen is cleared.
+ */
+void HistoryChart::invalidate(){
+  valid = false;
+}
+
+
+/* Private functions ---------------------------------------------------------*/
+/**
+ * @brief Adjusts the scale when the samples shown don't fit in it or use only a small part of it. The new
+ *        scale is centered on the samples, with some margin so the next samples are likely to fit too.
+ *
+ * @param[in] samples The samples, from the oldest to the newest.
+ * @param[in] min_span The minimum difference between the values of the top and bottom rows.
+ *
+ * @return True if the scale has changed.
+ */
+bool HistoryChart::fit_scale(const std::vector<float> &samples, float min_span){
+  if(samples.empty())
+    return false;
+
+  auto first = samples.end() - std::min((int)samples.size(), width);
+  auto range = std::minmax_element(first, samples.end());
+  float low = *range.first, high = *range.second;
+  float needed_span = std::max((high - low) * SCALE_MARGIN, min_span);
+
+  if(scale_min < scale_max && low >= scale_min && high <= scale_max &&
+      scale_max - scale_min <= needed_span * MAX_SCALE_SLACK)
+    return false;
+
+  scale_min = (low + high - needed_span) / 2;
+  scale_max = scale_min + needed_span;
+  return true;
+}
+
+
+/**
+ * @brief Obtains the row of the chart, from 0 (top) to height - 1 (bottom), that corresponds to a value.
+ *
+ * @param[in] value The value. Values out of the scale are drawn in the top or bottom row.
+ *
+ * @return The row.
+ */
+int HistoryChart::value_row(float value) const{
+  int row = std::lround((scale_max - value) * (height - 1) / (scale_max - scale_min));
+  return std::min(std::max(row, 0), height - 1);
+}
+
+
+/**
+ * @brief Draws the line in some columns of the chart. The background of the columns must already be drawn
+ *        when "first_column" is 0, otherwise it is drawn here. Each column joins its sample with the previous
+ *        one with a vertical segment, so the line has no gaps.
+ *
+ * @param[in] display The Display where the chart is.
+ * @param[in] samples The samples, from the oldest to the newest.
+ * @param[in] first_column First column to draw.
+ * @param[in] end_column Column after the last one to draw.
+ * @param[in] color Color of the line.
+ */
+void HistoryChart::draw_columns(Display_driver &display, const std::vector<float> &samples, int first_column,
+    int end_column, uint8_t color[]){
+  uint8_t background_color[] = {(uint8_t)(background & 0xFF), (uint8_t)(background >> 8)};
+  int first_sample = (int)samples.size() - width;   //Sample shown in column 0. Negative if there are less samples
+
+  if(first_column > 0)
+    display.reset_region(start_x + first_column, start_y, start_x + end_column, start_y + height, background_color);
+
+  for(int column = first_column; column < end_column; column++){
+    int i = first_sample + column;
+    if(i < 0)
+      continue;
+
+    int row = value_row(samples[i]);
+    int previous_row = i > 0 ? value_row(samples[i - 1]) : row;
+    display.reset_region(start_x + column, start_y + std::min(row, previous_row),
+        start_x + column + 1, start_y + std::max(row, previous_row) + 1, color);
+  }
+}
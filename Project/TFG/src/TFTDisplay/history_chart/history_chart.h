@@ -0,0 +1,99 @@
+/**
+  ******************************************************************************
+  * @file   history_chart.h
+  * @author Pablo San Millán Fierro (pablo.sanmillanf@alumnos.upm.es)
+  * @brief  Scrolling history chart Module Header.
+  *
+  * @note   End-of-degree work.
+  *         This module draws the recent history of a measure as a line
+  *         chart whose newest sample is in the rightmost column. When new
+  *         samples arrive, the chart is moved to the left and only the new
+  *         columns are drawn.
+  ******************************************************************************
+*/
+
+#ifndef __HISTORY_CHART_H__
+#define __HISTORY_CHART_H__
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <vector>
+
+/* Exported types ------------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported Classes ----------------------------------------------------------*/
+
+class Display_driver;
+
+class HistoryChart{
+  int start_x;
+  int start_y;
+  int width;
+  int height;
+
+  bool valid;                 //False if the panel contents of the chart are unknown
+  long sequence;              //Sequence number of the newest drawn sample
+  float scale_min;            //Values of the bottom and the top rows
+  float scale_max;
+  uint16_t color;
+  uint16_t background;
+
+  bool fit_scale(const std::vector<float> &samples, float min_span);
+  int value_row(float value) const;
+  void draw_columns(Display_driver &display, const std::vector<float> &samples, int first_column, int end_column,
+      uint8_t color[]);
+public:
+
+  /**
+   * @brief Class constructor. Sets the place of the chart. Each column of the chart shows one sample.
+   *
+   * @param[in] start_x X coordinate of the top left corner of the chart.
+   * @param[in] start_y Y coordinate of the top left corner of the chart.
+   * @param[in] width Width of the chart in pixels, i.e. the number of samples shown.
+   * @param[in] height Height of the chart in pixels.
+   */
+  HistoryChart(int start_x, int start_y, int width, int height);
+
+  /**
+   * @brief Draws the last samples of a history. If the chart is already in the Display with the same colors and
+   *        the new samples fit in its scale, the chart is moved to the left as many columns as new samples there
+   *        are and only the new columns are drawn. Otherwise the scale is adjusted to the samples and the whole
+   *        chart is drawn.
+   *
+   * @param[in] display The Display where the chart is.
+   * @param[in] samples The samples, from the oldest to the newest.
+   * @param[in] sequence The number of samples added to the history since its start, as returned by
+   *                     MeasureHistory::get_samples. It tells how many samples are new since the last draw.
+   * @param[in] min_span The minimum difference between the values of the top and bottom rows, so the noise of
+   *                     a stable measure isn't magnified.
+   * @param[in] color Color of the line.
+   * @param[in] background_color Color of the rest of the chart.
+   */
+  void draw(Display_driver &display, const std::vector<float> &samples, long sequence, float min_span,
+      uint8_t color[], uint8_t background_color[]);
+
+  /**
+   * @brief Obtain the value of the bottom row of the chart.
+   *
+   * @return The value.
+   */
+  float get_scale_min() const;
+
+  /**
+   * @brief Obtain the value of the top row of the chart.
+   *
+   * @return The value.
+   */
+  float get_scale_max() const;
+
+  /**
+   * @brief Forgets the drawn chart, so the next draw redraws it completely. Must be called when something
+   *        else is drawn over the chart, e.g. when the screen is cleared.
+   */
+  void invalidate();
+};
+
+/* Exported Functions --------------------------------------------------------*/
+
+#endif /* __HISTORY_CHART_H__ */
@@ -17,35 +17,43 @@
 /* Includes ------------------------------------------------------------------*/
 #include <cstdint>
 #include <vector>
+#include "icon_bitmaps.h"
+#include "../frame_arena/frame_arena.h"
 
 
 namespace Icons{
 
 /* Exported types ------------------------------------------------------------*/
+
+/**
+ * Pixels of one row of a bar, relative to the left column of the bar.
+ */
+typedef struct{
+  uint8_t offset;
+  uint8_t width;
+}BAR_ROW;
+
+/**
+ * Geometry of the bar of an icon. The bar is filled from its lowest row upwards.
+ */
+typedef struct{
+  const uint8_t *icon;      //Packed icon with the bar empty
+  int icon_size;            //Size of the icon in bytes
+  int icon_width;
+  int bar_x;                //Left column of the bar in its non-rounded area
+  int bar_y;                //Lowest row of the bar
+  int max_bar_width;
+  int max_bar_height;
+  const BAR_ROW *rows;      //"max_bar_height" rows, the lowest first
+}BAR_SHAPE;
+
 /* Exported variables --------------------------------------------------------*/
-extern std::vector<uint16_t>  unchecked_icon;
-extern std::vector<uint16_t>  checked_icon;
-
-extern std::vector<uint16_t> menu_square_icon;
-extern std::vector<uint16_t> menu_back_icon;
-extern std::vector<uint16_t> menu_ok_icon;
-extern std::vector<uint16_t> menu_up_icon;
-extern std::vector<uint16_t> menu_down_icon;
-extern std::vector<uint16_t> save_conf_icon;
-extern std::vector<uint16_t> yes_no_icon;
-
-extern std::vector<uint16_t> edit_menu_square;
-extern std::vector<uint16_t> edit_menu_left;
-extern std::vector<uint16_t> edit_menu_right;
-extern std::vector<uint16_t> edit_menu_up;
-extern std::vector<uint16_t> edit_menu_down;
-
-extern std::vector<uint16_t> clock_icon;
-extern std::vector<uint16_t> pressure_icon;
-extern std::vector<uint16_t> altitude_icon;
-extern std::vector<uint16_t> main_conf_icon;
-extern std::vector<uint16_t> celsius_icon;
-extern std::vector<uint16_t> percentage_icon;
+/*
+ * The icon bitmaps are generated from the PBM files of "assets/icons" by "tools/icon_compiler.py" and are
+ * declared in "icon_bitmaps.h". Every icon is stored with 1 bit per pixel, rows padded to a whole byte, so
+ * they must be drawn with Display_driver::draw_icon_col. The temperature, humidity and IAQ icons must be
+ * obtained with their "get_*_icon" functions, that fill their bars.
+ */
 
 extern const int checked_unchecked_icon_width;
 extern const int main_menu_metrics;
@@ -68,6 +76,10 @@ extern const int celsius_icon_width;
 extern const int percentage_icon_width;
 extern const int main_menu_indicator_width;
 
+extern const BAR_SHAPE temperature_bar;
+extern const BAR_SHAPE humidity_bar;
+extern const BAR_SHAPE iaq_bar;
+
 /* Exported constants --------------------------------------------------------*/
 /* Exported macro ------------------------------------------------------------*/
 /* Exported Functions --------------------------------------------------------*/
@@ -76,28 +88,63 @@ extern const int main_menu_indicator_width;
  * @brief Obtain the temperature icon with its bar icon filled "bar_percentage" percentage.
  *
  * @param[in] bar_percentage The bar percentage. Percentages greater than 100 will be truncated to 100.
+ * @param[in] arena Where the icon is allocated.
  *
  * @return The icon with the bar filled "bar_percentage" percentage.
  */
-std::vector<uint16_t> get_temperature_icon(uint8_t bar_percentage);
+ArenaSpan<uint8_t> get_temperature_icon(uint8_t bar_percentage, FrameArena &arena);
 
 /**
  * @brief Obtain the humidity icon with its bar icon filled "bar_percentage" percentage.
  *
  * @param[in] bar_percentage The bar percentage. Percentages greater than 100 will be truncated to 100.
+ * @param[in] arena Where the icon is allocated.
  *
  * @return The icon with the bar filled "bar_percentage" percentage.
  */
-std::vector<uint16_t> get_humidity_icon(uint8_t bar_percentage);
+ArenaSpan<uint8_t> get_humidity_icon(uint8_t bar_percentage, FrameArena &arena);
 
 /**
  * @brief Obtain the IAQ icon with its bar icon filled "bar_percentage" percentage.
  *
  * @param[in] bar_percentage The bar percentage. Percentages greater than 100 will be truncated to 100.
+ * @param[in] arena Where the icon is allocated.
  *
  * @return The icon with the bar filled "bar_percentage" percentage.
  */
-std::vector<uint16_t> get_iaq_icon(uint16_t bar_percentage);
+ArenaSpan<uint8_t> get_iaq_icon(uint16_t bar_percentage, FrameArena &arena);
+
+/**
+ * @brief Obtain the percentage of the IAQ bar that get_iaq_icon fills for an IAQ value. The bar is full
+ *        for the best air quality and empty from 500 onwards.
+ *
+ * @param[in] iaq The IAQ.
+ *
+ * @return The bar percentage.
+ */
+uint8_t get_iaq_bar_percentage(uint16_t iaq);
+
+/**
+ * @brief Obtain the number of rows of a bar filled for a percentage.
+ *
+ * @param[in] bar The bar.
+ * @param[in] bar_percentage The bar percentage. Percentages greater than 100 will be truncated to 100.
+ *
+ * @return The number of filled rows, counting from the lowest one.
+ */
+int get_bar_level(const BAR_SHAPE &bar, uint8_t bar_percentage);
+
+/**
+ * @brief Redraws some rows of the bar of a packed icon. The rows are restored from the bar icon and the
+ *        ones below "level" are filled with cleared pixels.
+ *
+ * @param[in] bar The bar.
+ * @param[in] first_row The first row to redraw. Rows are counted from the lowest one.
+ * @param[in] end_row The row after the last one to redraw.
+ * @param[in] level Number of filled rows, as returned by get_bar_level.
+ * @param[inout] icon The packed icon. Must have the size of the bar icon.
+ */
+void set_bar_rows(const BAR_SHAPE &bar, int first_row, int end_row, int level, uint8_t *icon);
 
 
 /**
@@ -109,10 +156,11 @@ std::vector<uint16_t> get_iaq_icon(uint16_t bar_percentage);
  *  \______/  \______/  \______/  \______/  \______/  \______/
  *
  * @param[in] selected Number from 1 to 6 that indicates the selected circle.
+ * @param[in] arena Where the icon is allocated.
  *
  * @return The menu indicator icon.
  */
-std::vector<uint16_t> get_main_menu_indicator_icon(uint8_t selected);
+ArenaSpan<uint8_t> get_main_menu_indicator_icon(uint8_t selected, FrameArena &arena);
 }
 
 #endif /* __ICON_MANAGER_H__ */
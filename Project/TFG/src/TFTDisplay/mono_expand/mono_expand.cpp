@@ -0,0 +1,161 @@
+/**
+  ******************************************************************************
+  * @file   mono_expand.cpp
+  * @author Pablo San Millán Fierro (pablo.sanmillanf@alumnos.upm.es)
+  * @brief  1 bit per pixel to RGB565 expansion Module.
+  *
+  * @note   End-of-degree work.
+  *         This module converts packed monochrome bitmaps (icons and font
+  *         glyphs) into RGB565 pixels. It uses NEON, AVX2 or SSE2 when the
+  *         compiler targets them and plain C++ otherwise.
+  ******************************************************************************
+*/
+
+/* Includes ------------------------------------------------------------------*/
+#include "mono_expand.h" // Module header
+
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#elif defined(__arm__)
+#warning "NEON is not enabled (-mfpu=neon-vfpv4), the scalar expansion will be used"
+#elif defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+/* Private defines -----------------------------------------------------------*/
+/* Private typedef -----------------------------------------------------------*/
+/* Private variables----------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static inline uint8_t get_byte(const uint8_t bits[], int index, int shift);
+static inline void expand_byte(uint8_t byte, uint16_t color, uint16_t background, uint16_t pixels[]);
+#if defined(__AVX2__)
+static inline void expand_word(uint16_t word, uint16_t color, uint16_t background, uint16_t pixels[]);
+#endif
+/* Functions -----------------------------------------------------------------*/
+
+/**
+ * @brief Obtain the name of the instruction set used by expand, e.g. "neon" or "scalar".
+ *
+ * @return The name.
+ */
+const char *MonoExpand::get_kernel_name(){
+#if defined(__ARM_NEON)
+  return "neon";
+#elif defined(__AVX2__)
+  return "avx2";
+#elif defined(__SSE2__)
+  return "sse2";
+#else
+  return "scalar";
+#endif
+}
+
+
+/**
+ * @brief Converts consecutive bits of a 1 bit per pixel bitmap into RGB565 pixels. Set bits take the "color"
+ *        color and cleared bits take the "background" color. The colors are copied as they are, so the
+ *        pixels keep the byte order of the supplied colors.
+ *
+ * @param[in] bits Bits of the bitmap. The MSB of every byte is the leftmost pixel.
+ * @param[in] first_bit Index of the first bit to convert, counted from the MSB of bits[0].
+ * @param[in] count Number of bits to convert.
+ * @param[in] color Color of the set bits.
+ * @param[in] background Color of the cleared bits.
+ * @param[out] pixels Where the "count" pixels are written.
+ */
+void MonoExpand::expand(const uint8_t bits[], int first_bit, int count, uint16_t color, uint16_t background,
+    uint16_t pixels[]){
+
+  if(count <= 0)
+    return;
+
+  bits += first_bit / 8;
+  int shift = first_bit % 8;
+  int groups = count / 8;
+  int group = 0;
+
+#if defined(__AVX2__)
+  for(; group + 2 <= groups; group += 2){
+    uint16_t word = (get_byte(bits, group, shift) << 8) | get_byte(bits, group + 1, shift);
+    expand_word(word, color, background, pixels + group * 8);
+  }
+#endif
+  for(; group < groups; group++)
+    expand_byte(get_byte(bits, group, shift), color, background, pixels + group * 8);
+
+  //Last pixels that don't fill a whole byte
+  for(int i = groups * 8; i < count; i++){
+    int bit = shift + i;
+    pixels[i] = (bits[bit / 8] & (0x80 >> (bit % 8))) ? color : background;
+  }
+}
+
+
+/* Private functions ---------------------------------------------------------*/
+/**
+ * @brief Obtain 8 consecutive bits of a bitmap that may not start at a byte boundary. Only reads the
+ *        bytes that contain those 8 bits.
+ *
+ * @param[in] bits Bits of the bitmap.
+ * @param[in] index Index of the group of 8 bits.
+ * @param[in] shift Bits from the MSB of bits[0] to the first bit of group 0.
+ *
+ * @return The 8 bits, with the first one in the MSB.
+ */
+static inline uint8_t get_byte(const uint8_t bits[], int index, int shift){
+  if(shift == 0)
+    return bits[index];
+  return (bits[index] << shift) | (bits[index + 1] >> (8 - shift));
+}
+
+
+/**
+ * @brief Converts 8 bits into 8 pixels.
+ *
+ * @param[in] byte The bits. The MSB is the first pixel.
+ * @param[in] color Color of the set bits.
+ * @param[in] background Color of the cleared bits.
+ * @param[out] pixels Where the 8 pixels are written.
+ */
+static inline void expand_byte(uint8_t byte, uint16_t color, uint16_t background, uint16_t pixels[]){
+#if defined(__ARM_NEON)
+  static const uint16_t lane_bits[8] = {0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01};
+
+  uint16x8_t mask = vtstq_u16(vdupq_n_u16(byte), vld1q_u16(lane_bits));
+  vst1q_u16(pixels, vbslq_u16(mask, vdupq_n_u16(color), vdupq_n_u16(background)));
+#elif defined(__SSE2__)
+  const __m128i lane_bits = _mm_set_epi16(0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80);
+
+  __m128i mask = _mm_cmpeq_epi16(_mm_and_si128(_mm_set1_epi16(byte), lane_bits), lane_bits);
+  __m128i result = _mm_or_si128(_mm_and_si128(mask, _mm_set1_epi16(color)),
+      _mm_andnot_si128(mask, _mm_set1_epi16(background)));
+  _mm_storeu_si128((__m128i *)pixels, result);
+#else
+  uint16_t difference = color ^ background;
+
+  for(int i = 0; i < 8; i++){
+    uint16_t mask = -(uint16_t)((byte >> (7 - i)) & 1);
+    pixels[i] = background ^ (difference & mask);
+  }
+#endif
+}
+
+
+#if defined(__AVX2__)
+/**
+ * @brief Converts 16 bits into 16 pixels.
+ *
+ * @param[in] word The bits. The MSB is the first pixel.
+ * @param[in] color Color of the set bits.
+ * @param[in] background Color of the cleared bits.
+ * @param[out] pixels Where the 16 pixels are written.
+ */
+static inline void expand_word(uint16_t word, uint16_t color, uint16_t background, uint16_t pixels[]){
+  const __m256i lane_bits = _mm256_set_epi16(0x0001, 0x0002, 0x0004, 0x0008, 0x0010, 0x0020, 0x0040, 0x0080,
+      0x0100, 0x0200, 0x0400, 0x0800, 0x1000, 0x2000, 0x4000, (short)0x8000);
+
+  __m256i mask = _mm256_cmpeq_epi16(_mm256_and_si256(_mm256_set1_epi16(word), lane_bits), lane_bits);
+  __m256i result = _mm256_blendv_epi8(_mm256_set1_epi16(background), _mm256_set1_epi16(color), mask);
+  _mm256_storeu_si256((__m256i *)pixels, result);
+}
+#endif
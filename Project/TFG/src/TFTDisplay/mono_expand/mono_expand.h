@@ -0,0 +1,51 @@
+/**
+  ******************************************************************************
+  * @file   mono_expand.h
+  * @author Pablo San Millán Fierro (pablo.sanmillanf@alumnos.upm.es)
+  * @brief  1 bit per pixel to RGB565 expansion Module Header.
+  *
+  * @note   End-of-degree work.
+  *         This module converts packed monochrome bitmaps (icons and font
+  *         glyphs) into RGB565 pixels. It uses NEON, AVX2 or SSE2 when the
+  *         compiler targets them and plain C++ otherwise.
+  ******************************************************************************
+*/
+
+#ifndef __MONO_EXPAND_H__
+#define __MONO_EXPAND_H__
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+
+namespace MonoExpand{
+
+/* Exported types ------------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported Functions --------------------------------------------------------*/
+
+/**
+ * @brief Obtain the name of the instruction set used by expand, e.g. "neon" or "scalar".
+ *
+ * @return The name.
+ */
+const char *get_kernel_name();
+
+/**
+ * @brief Converts consecutive bits of a 1 bit per pixel bitmap into RGB565 pixels. Set bits take the "color"
+ *        color and cleared bits take the "background" color. The colors are copied as they are, so the
+ *        pixels keep the byte order of the supplied colors.
+ *
+ * @param[in] bits Bits of the bitmap. The MSB of every byte is the leftmost pixel.
+ * @param[in] first_bit Index of the first bit to convert, counted from the MSB of bits[0].
+ * @param[in] count Number of bits to convert.
+ * @param[in] color Color of the set bits.
+ * @param[in] background Color of the cleared bits.
+ * @param[out] pixels Where the "count" pixels are written.
+ */
+void expand(const uint8_t bits[], int first_bit, int count, uint16_t color, uint16_t background,
+    uint16_t pixels[]);
+
+}
+
+#endif /* __MONO_EXPAND_H__ */
@@ -0,0 +1,151 @@
+/**
+  ******************************************************************************
+  * @file   readout.cpp
+  * @author Pablo San Millán Fierro (pablo.sanmillanf@alumnos.upm.es)
+  * @brief  Live text readout Module.
+  *
+  * @note   End-of-degree work.
+  *         This module draws texts that are updated periodically in the same
+  *         place, like the main menu measures. It remembers the last drawn
+  *         text and only redraws the characters that have changed.
+  ******************************************************************************
+*/
+
+/* Includes ------------------------------------------------------------------*/
+#include "readout.h" // Module header
+#include "../display_driver/display_driver.h"
+#include <algorithm>
+
+/* Private defines -----------------------------------------------------------*/
+/* Private typedef -----------------------------------------------------------*/
+/* Private variables----------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static bool in_font(const Font &font, char c);
+/* Functions -----------------------------------------------------------------*/
+
+/**
+ * @brief Class constructor. Sets the place and the format of the readout.
+ *
+ * @param[in] start_x X coordinate of the start of the line where the text will be written. Ignored if
+ *                    "centered" is true.
+ * @param[in] start_y Y coordinate of the start of the line where the text will be written.
+ * @param[in] min_width Minimum width of the bounding box where the text will be located.
+ * @param[in] centered True to center the bounding box in the X-axis.
+ * @param[in] font font of the text.
+ */
+Readout::Readout(int start_x, int start_y, int min_width, bool centered, const Font &font):
+    start_x(start_x), start_y(start_y), min_width(min_width), centered(centered), font(font),
+    valid(false), color(0), background(0){
+}
+
+
+/**
+ * @brief Writes the text in the Display as Display_driver::write_string_with_min_width (or
+ *        Display_driver::write_string_centered_with_min_width) would do. If the previous text had the same
+ *        layout, only the characters that have changed are redrawn, and nothing is drawn if the text and
+ *        colors are the same.
+ *
+ * @param[in] display The Display where the readout is.
+ * @param[in] str string to write.
+ * @param[in] color color of the text to write.
+ * @param[in] background_color color of the background color of the box where the text will be located.
+ */
+void Readout::write(Display_driver &display, std::string str, uint8_t color[], uint8_t background_color[]){
+  uint16_t color16 = color[0] | (color[1] << 8);
+  uint16_t background16 = background_color[0] | (background_color[1] << 8);
+
+  if(valid && str == text && color16 == this->color && background16 == background)
+    return;
+
+  FrameArena &arena = display.get_frame_arena();
+  ArenaSpan<int> old_cells = arena.alloc<int>(text.size()), new_cells = arena.alloc<int>(str.size());
+  int old_width, new_width;
+  layout(text, old_cells.data(), &old_width);
+  layout(str, new_cells.data(), &new_width);
+
+  //The height of the bounding box only depends on the font, so the widths are enough to compare the layouts
+  bool same_layout = valid && color16 == this->color && background16 == background &&
+      str.size() == text.size() && old_width == new_width;
+
+  valid = true;
+  text.swap(str);   //From now on "text" is the new string and "str" the old one
+  this->color = color16;
+  background = background16;
+
+  if(!same_layout){
+    if(centered)
+      display.write_string_centered_with_min_width(
+          start_y, min_width, (char*) text.c_str(), color, background_color, font);
+    else
+      display.write_string_with_min_width(
+          start_x, start_y, min_width, (char*) text.c_str(), color, background_color, font);
+    return;
+  }
+
+  //Columns of the bounding box touched by the characters that changed, including the parts of their
+  //glyphs that spill over the neighbouring cells
+  int box_width = std::max(min_width, new_width);
+  int left_padding = centered ? (box_width - new_width)/2 : 0;
+  int first_column = box_width, end_column = 0;
+
+  for(size_t i = 0; i < text.size(); i++){
+    if(text[i] == str[i] && new_cells[i] == old_cells[i])
+      continue;
+
+    const std::string *versions[] = {&str, &text};
+    const int cells[] = {old_cells[i], new_cells[i]};
+    for(int v = 0; v < 2; v++){
+      char c = (*versions[v])[i];
+      if(!in_font(font, c))
+        continue;
+
+      const FontGlyph &glyph = font.glyph[(uint8_t)c - font.first];
+      first_column = std::min(first_column, left_padding + cells[v] + std::min(0, (int)glyph.x_offset));
+      end_column = std::max(end_column,
+          left_padding + cells[v] + std::max((int)glyph.x_advance, glyph.x_offset + glyph.width));
+    }
+  }
+
+  if(first_column < end_column){
+    display.write_string_columns(
+        start_x, start_y, min_width, centered, first_column, end_column,
+        (char*) text.c_str(), color, background_color, font);
+  }
+}
+
+
+/**
+ * @brief Forgets the last drawn text, so the next write draws the whole bounding box. Must be called when
+ *        something else is drawn over the readout, e.g. when the screen is cleared.
+ */
+void Readout::invalidate(){
+  valid = false;
+}
+
+
+/* Private functions ---------------------------------------------------------*/
+/**
+ * @brief Obtains the position of every character of a string, the same way Display_driver lays it out.
+ *
+ * @param[in] str The string.
+ * @param[out] cells_x X coordinate of every character, relative to the start of the text. Must have room for
+ *                     one value per character.
+ * @param[out] width Width of the text.
+ */
+void Readout::layout(const std::string &str, int cells_x[], int *width) const{
+  *width = 0;
+
+  for(size_t i = 0; i < str.size(); i++){
+    cells_x[i] = *width;
+    if(in_font(font, str[i]))
+      *width += font.glyph[(uint8_t)str[i] - font.first].x_advance;
+  }
+}
+
+
+/**
+ * @brief Checks if a character has a glyph in the font.
+ */
+static bool in_font(const Font &font, char c){
+  return (uint8_t)c >= font.first && (uint8_t)c <= font.last;
+}
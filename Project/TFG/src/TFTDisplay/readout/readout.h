@@ -0,0 +1,78 @@
+/**
+  ******************************************************************************
+  * @file   readout.h
+  * @author Pablo San Millán Fierro (pablo.sanmillanf@alumnos.upm.es)
+  * @brief  Live text readout Module Header.
+  *
+  * @note   End-of-degree work.
+  *         This module draws texts that are updated periodically in the same
+  *         place, like the main menu measures. It remembers the last drawn
+  *         text and only redraws the characters that have changed.
+  ******************************************************************************
+*/
+
+#ifndef __READOUT_H__
+#define __READOUT_H__
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <string>
+#include "../fonts/font.h"
+
+/* Exported types ------------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported Classes ----------------------------------------------------------*/
+
+class Display_driver;
+
+class Readout{
+  int start_x;
+  int start_y;
+  int min_width;
+  bool centered;
+  const Font &font;
+
+  bool valid;                 //False if the panel contents of the readout are unknown
+  std::string text;
+  uint16_t color;
+  uint16_t background;
+
+  void layout(const std::string &str, int cells_x[], int *width) const;
+public:
+
+  /**
+   * @brief Class constructor. Sets the place and the format of the readout.
+   *
+   * @param[in] start_x X coordinate of the start of the line where the text will be written. Ignored if
+   *                    "centered" is true.
+   * @param[in] start_y Y coordinate of the start of the line where the text will be written.
+   * @param[in] min_width Minimum width of the bounding box where the text will be located.
+   * @param[in] centered True to center the bounding box in the X-axis.
+   * @param[in] font font of the text.
+   */
+  Readout(int start_x, int start_y, int min_width, bool centered, const Font &font);
+
+  /**
+   * @brief Writes the text in the Display as Display_driver::write_string_with_min_width (or
+   *        Display_driver::write_string_centered_with_min_width) would do. If the previous text had the same
+   *        layout, only the characters that have changed are redrawn, and nothing is drawn if the text and
+   *        colors are the same.
+   *
+   * @param[in] display The Display where the readout is.
+   * @param[in] str string to write.
+   * @param[in] color color of the text to write.
+   * @param[in] background_color color of the background color of the box where the text will be located.
+   */
+  void write(Display_driver &display, std::string str, uint8_t color[], uint8_t background_color[]);
+
+  /**
+   * @brief Forgets the last drawn text, so the next write draws the whole bounding box. Must be called when
+   *        something else is drawn over the readout, e.g. when the screen is cleared.
+   */
+  void invalidate();
+};
+
+/* Exported Functions --------------------------------------------------------*/
+
+#endif /* __READOUT_H__ */
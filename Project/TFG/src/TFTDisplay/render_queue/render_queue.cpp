@@ -0,0 +1,131 @@
+/**
+  ******************************************************************************
+  * @file   render_queue.cpp
+  * @author Pablo San Millán Fierro (pablo.sanmillanf@alumnos.upm.es)
+  * @brief  Draw command queue Module.
+  *
+  * @note   End-of-degree work.
+  *         This module implements the queue that communicates the threads
+  *         that request screens with the thread that draws them. Commands
+  *         that are made obsolete by a newer one are discarded before being
+  *         drawn.
+  ******************************************************************************
+*/
+
+/* Includes ------------------------------------------------------------------*/
+#include "render_queue.h" // Module header
+#include <algorithm>
+
+/* Private defines -----------------------------------------------------------*/
+/* Private typedef -----------------------------------------------------------*/
+/* Private variables----------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+/* Functions -----------------------------------------------------------------*/
+
+/**
+ * @brief Class constructor. Creates an empty and open queue.
+ */
+RenderQueue::RenderQueue(): busy(false), closed(false){
+}
+
+
+/**
+ * @brief Push a command in the queue, discarding the pending commands that it makes obsolete. Also,
+ *        notify the insertion to the thread waiting for a command.
+ *
+ * @param[in] command The command to be pushed.
+ */
+void RenderQueue::push(DRAW_COMMAND command){
+  std::lock_guard<std::mutex> lock(mutex);
+
+  if(command.full_screen){
+    commands.erase(
+        std::remove_if(commands.begin(), commands.end(),
+            [](const DRAW_COMMAND &pending){ return pending.droppable; }),
+        commands.end());
+  }
+  else if(command.key != 0){
+    commands.erase(
+        std::remove_if(commands.begin(), commands.end(),
+            [&command](const DRAW_COMMAND &pending){ return pending.key == command.key; }),
+        commands.end());
+  }
+
+  commands.push_back(command);
+  cond.notify_all();
+}
+
+
+/**
+ * @brief Obtain the oldest command of the queue. If the queue is empty, the thread waits until another
+ *        thread pushes a command or closes the queue. A command that newer ones can replace (with a key
+ *        and not full screen) isn't returned before "hold_until", so the commands pushed meanwhile replace
+ *        it and only the newest one is drawn. The caller must call done() once the command has been drawn.
+ *
+ * @param[out] command The oldest command of the queue.
+ * @param[in] hold_until The time before which the replaceable commands are held in the queue.
+ *
+ * @return False if the queue is closed and empty, true otherwise.
+ */
+bool RenderQueue::pop(DRAW_COMMAND *command, std::chrono::steady_clock::time_point hold_until){
+  std::unique_lock<std::mutex> lock(mutex);
+  while(true){
+    while(commands.empty() && !closed){
+      cond.wait(lock);
+    }
+    if(commands.empty())
+      return false;
+
+    const DRAW_COMMAND &oldest = commands.front();
+    if(closed || oldest.key == 0 || oldest.full_screen || std::chrono::steady_clock::now() >= hold_until)
+      break;
+    cond.wait_until(lock, hold_until);
+  }
+
+  *command = commands.front();
+  commands.pop_front();
+  busy = true;
+  return true;
+}
+
+
+/**
+ * @brief Notify that the command obtained with pop() has been drawn.
+ */
+void RenderQueue::done(){
+  std::lock_guard<std::mutex> lock(mutex);
+  busy = false;
+  cond.notify_all();
+}
+
+
+/**
+ * @brief Wait until all the pushed commands have been drawn.
+ */
+void RenderQueue::wait_idle(){
+  std::unique_lock<std::mutex> lock(mutex);
+  while(!commands.empty() || busy){
+    cond.wait(lock);
+  }
+}
+
+
+/**
+ * @brief Close the queue. The pending commands can still be obtained with pop().
+ */
+void RenderQueue::close(){
+  std::lock_guard<std::mutex> lock(mutex);
+  closed = true;
+  cond.notify_all();
+}
+
+
+/**
+ * @brief Return the number of pending commands in the queue.
+ *
+ * @return The number of commands.
+ */
+int RenderQueue::size(){
+  std::lock_guard<std::mutex> lock(mutex);
+  return commands.size();
+}
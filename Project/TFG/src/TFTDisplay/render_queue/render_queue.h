@@ -0,0 +1,104 @@
+/**
+  ******************************************************************************
+  * @file   render_queue.h
+  * @author Pablo San Millán Fierro (pablo.sanmillanf@alumnos.upm.es)
+  * @brief  Draw command queue Module Header.
+  *
+  * @note   End-of-degree work.
+  *         This module implements the queue that communicates the threads
+  *         that request screens with the thread that draws them. Commands
+  *         that are made obsolete by a newer one are discarded before being
+  *         drawn.
+  ******************************************************************************
+*/
+
+#ifndef __RENDER_QUEUE_H__
+#define __RENDER_QUEUE_H__
+
+/* Includes ------------------------------------------------------------------*/
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <condition_variable>
+
+/* Exported types ------------------------------------------------------------*/
+
+/**
+ * Draw command. "key" identifies the elements drawn by the command: a command replaces the pending
+ * ones with its same key (0 means that the command is never replaced). A "full_screen" command
+ * repaints the whole screen, so it replaces all the pending commands that are "droppable". The
+ * commands that change the state of the panel instead of drawing (e.g. sleep or wake) aren't
+ * droppable, since a newer screen doesn't make them obsolete.
+ */
+typedef struct{
+  int key;
+  bool full_screen;
+  std::function<void ()> draw;
+  bool droppable = true;
+}DRAW_COMMAND;
+
+/* Exported constants --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported Classes ----------------------------------------------------------*/
+
+class RenderQueue{
+  std::deque<DRAW_COMMAND> commands;
+  std::mutex mutex;
+  std::condition_variable cond;
+  bool busy;
+  bool closed;
+public:
+
+  /**
+   * @brief Class constructor. Creates an empty and open queue.
+   */
+  RenderQueue();
+
+  /**
+   * @brief Push a command in the queue, discarding the pending commands that it makes obsolete. Also,
+   *        notify the insertion to the thread waiting for a command.
+   *
+   * @param[in] command The command to be pushed.
+   */
+  void push(DRAW_COMMAND command);
+
+  /**
+   * @brief Obtain the oldest command of the queue. If the queue is empty, the thread waits until another
+   *        thread pushes a command or closes the queue. A command that newer ones can replace (with a key
+   *        and not full screen) isn't returned before "hold_until", so the commands pushed meanwhile replace
+   *        it and only the newest one is drawn. The caller must call done() once the command has been drawn.
+   *
+   * @param[out] command The oldest command of the queue.
+   * @param[in] hold_until The time before which the replaceable commands are held in the queue.
+   *
+   * @return False if the queue is closed and empty, true otherwise.
+   */
+  bool pop(DRAW_COMMAND *command, std::chrono::steady_clock::time_point hold_until);
+
+  /**
+   * @brief Notify that the command obtained with pop() has been drawn.
+   */
+  void done();
+
+  /**
+   * @brief Wait until all the pushed commands have been drawn.
+   */
+  void wait_idle();
+
+  /**
+   * @brief Close the queue. The pending commands can still be obtained with pop().
+   */
+  void close();
+
+  /**
+   * @brief Return the number of pending commands in the queue.
+   *
+   * @return The number of commands.
+   */
+  int size();
+};
+
+/* Exported Functions --------------------------------------------------------*/
+
+#endif /* __RENDER_QUEUE_H__ */
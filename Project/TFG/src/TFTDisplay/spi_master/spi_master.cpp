@@ -1,15 +1,52 @@
 #include "spi_master.h"
 #include "../../custom_gpio/custom_gpio.h"
+#include <algorithm>
+#include <atomic>
+#include <signal.h>
+#include <sched.h>
+#include <time.h>
 
-static int fd;
+static const char spidev_bufsiz_path[] = "/sys/module/spidev/parameters/bufsiz";
+static const int default_bufsiz = 4096;         //spidev default when the parameter can't be read
 
-static CustomGPIO::GPIO gpio17(17);
-static bool previous_cmd = false;
+static const int latency_buckets = sizeof(SPI_PHASE_STATS::latency_histogram) / sizeof(uint64_t);
+
+//Started links, dumped by the statistics signal handler. A fixed array, so the handler doesn't need locks.
+static const int max_links = 8;
+static std::atomic<SPI_Master *> started_links[max_links];
+//Number of statistics signal handlers running. A link waits for it to be 0 after leaving started_links, so no
+//handler can be using it when it is destroyed. Blocking the signal isn't enough: any other thread can handle it
+static std::atomic<int> running_handlers(0);
+
+static int64_t get_time_ns();
+static int write_phase_stats(int fd, int spi_device, const char name[], const SPI_PHASE_STATS &stats);
+static int write_text(int fd, const char text[]);
+static int write_number(int fd, uint64_t number);
+static void stats_signal_handler(int signum);
+
+/**
+ * @brief Class constructor. Sets the GPIO of the DC line. Nothing is opened until spi_start is called.
+ *
+ * @param[in] dc_pin The GPIO connected to the DC pin of the panel.
+ */
+SPI_Master::SPI_Master(int dc_pin):
+    dc_pin(dc_pin), spi_device(-1), fd(0), previous_cmd(false), bufsiz(default_bufsiz), dc_changes(0){
+  reset_spi_stats();
+}
 
-struct spi_ioc_transfer tr;
 
 /**
- * @brief Starts the SPI device and configures it to allow SPI communications.
+ * @brief Class destructor. Ends the SPI communications if they are still started.
+ */
+SPI_Master::~SPI_Master(){
+  if(fd != 0)
+    spi_end();
+}
+
+
+/**
+ * @brief Starts the SPI device and configures it to allow SPI communications. If the device can't be configured,
+ *        it is closed again. Only the first 8 started links are dumped by the statistics signal handler.
  * 
  * @param[in] spi_device Indicates which SPI device of type spidev0.<number> 
  *                       within the /dev/ directory will be used.
@@ -17,6 +54,7 @@ struct spi_ioc_transfer tr;
  * @return 0 if success, -1 if error.
  */
 int SPI_Master::spi_start (int spi_device, int mode, int bits, int speed) {
+	bool opened = false;
 
 	if(fd == 0){
     //Open file descriptor
@@ -26,41 +64,56 @@ int SPI_Master::spi_start (int spi_device, int mode, int bits, int speed) {
     fd = open(spiFile, O_RDWR);
 
     if(fd == -1){
+      fd = 0;
       return -1;
     }
+    this->spi_device = spi_device;
+    opened = true;
 	}
 
-	if(ioctl(fd, SPI_IOC_WR_MODE32, &mode))
-	  return -1;
-
-	if(ioctl(fd, SPI_IOC_RD_MODE, &mode))
-	  return -1;
-
-	if(ioctl(fd, SPI_IOC_WR_BITS_PER_WORD, &bits))
-	  return -1;
-
-	if(ioctl(fd, SPI_IOC_RD_BITS_PER_WORD, &bits))
+	if(ioctl(fd, SPI_IOC_WR_MODE32, &mode) || ioctl(fd, SPI_IOC_RD_MODE, &mode) ||
+	    ioctl(fd, SPI_IOC_WR_BITS_PER_WORD, &bits) || ioctl(fd, SPI_IOC_RD_BITS_PER_WORD, &bits) ||
+	    ioctl(fd, SPI_IOC_WR_MAX_SPEED_HZ, &speed) || ioctl(fd, SPI_IOC_RD_MAX_SPEED_HZ, &speed)){
+	  fprintf(stderr,"ERROR: Couldn't configure spidev0.%d. Error description: %s\n", spi_device, strerror(errno));
+	  spi_end();
 	  return -1;
+	}
 
-	if(ioctl(fd, SPI_IOC_WR_MAX_SPEED_HZ, &speed))
-	  return -1;
+	if(opened){
+	  bool registered = false;
+	  for(int i = 0; i < max_links && !registered; i++){
+	    SPI_Master *expected = NULL;
+	    registered = started_links[i].compare_exchange_strong(expected, this);
+	  }
+	  if(!registered)
+	    fprintf(stderr,"WARNING: More than %d SPI links started. spidev0.%d won't appear in the statistics dump\n",
+	        max_links, spi_device);
+	}
 
-	if(ioctl(fd, SPI_IOC_RD_MAX_SPEED_HZ, &speed))
-	  return -1;
+	FILE *bufsiz_file = fopen(spidev_bufsiz_path, "r");
+	if(bufsiz_file != NULL){
+	  if(fscanf(bufsiz_file, "%d", &bufsiz) != 1 || bufsiz <= 0)
+	    bufsiz = default_bufsiz;
+	  fclose(bufsiz_file);
+	}
 
-	gpio17.setOutput();
-	gpio17.write(true);
+	if(!dc_line){
+	  dc_line.reset(new CustomGPIO::GPIO(dc_pin));
+	  dc_line->setOutput();
+	  dc_line->write(true);
+	  previous_cmd = false;
+	}
 
 	return 0;
 }
 
 /**
  * @brief It sends SPI data of length "size" to the other SPI end, at a speed "speed" and with a delay time "delay" after the data is sent.
- *        The response is stored in the rx buffer. To differentiate between normal data and commands, the GPIO17 pin will be enabled or
+ *        The response is stored in the rx buffer. To differentiate between normal data and commands, the DC pin will be enabled or
  *        disabled. This will be indicated by the parameter "cmd".
  *
  * @param[in] messages Pointer to the SPI data to send.
- * @param[in] rx Pointer to the array where the response will be stored.
+ * @param[in] rx Pointer to the array where the response will be stored, or NULL to ignore the response.
  * @param[in] cmd If true, the data sent is a command, if false, it is normal data.
  * @param[in] size The size of the data sent.
  * @param[in] speed Speed of the SPI link.
@@ -75,14 +128,13 @@ void SPI_Master::send_spi_msg(uint8_t* messages, uint8_t rx[], uint8_t cmd, int
 	tr.speed_hz = speed;
 	tr.bits_per_word = 0;
 
-	if(previous_cmd != cmd){
-	  previous_cmd = cmd;
-	  gpio17.write(!cmd);
-	}
+	set_dc_line(cmd);
 
 	// Send SPI data
 
+	int64_t start_ns = get_time_ns();
 	int ret = ioctl(fd, SPI_IOC_MESSAGE(1), &tr);
+	record_message(cmd, 1, size, get_time_ns() - start_ns, ret == -1);
 
 	if(ret == -1){
 		fprintf(stderr,"ERROR: Error in SPI transmission. Couldn't perform. Error description: %s\n", strerror(errno));
@@ -90,17 +142,408 @@ void SPI_Master::send_spi_msg(uint8_t* messages, uint8_t rx[], uint8_t cmd, int
 }
 
 
+/**
+ * @brief Sends a group of data blocks as one continuous stream without reading the response. The blocks are packed into
+ *        as few ioctl calls as possible: every call carries several transfers whose total size doesn't exceed the spidev
+ *        buffer size, and blocks larger than that are split across calls.
+ *
+ * @param[in] segments The data blocks to send, in order.
+ * @param[in] count The number of blocks.
+ * @param[in] cmd If true, the data sent is a command, if false, it is normal data.
+ * @param[in] speed Speed of the SPI link.
+ *
+ * @return 0 if success, -1 if error.
+ */
+int SPI_Master::send_spi_segments(const SPI_SEGMENT segments[], int count, uint8_t cmd, int speed){
+
+	int n_transfers = 0, msg_total = 0, status = 0;
+
+	set_dc_line(cmd);
+
+	for(int i = 0; i < count; i++){
+	  const uint8_t *data = segments[i].data;
+	  int remaining = segments[i].size;
+
+	  while(remaining > 0){
+	    if(msg_total == bufsiz || n_transfers == max_transfers_per_msg){
+	      if(submit_transfers(n_transfers, cmd) == -1)
+	        status = -1;
+	      n_transfers = 0;
+	      msg_total = 0;
+	    }
+
+	    int len = std::min(remaining, bufsiz - msg_total);
+
+	    memset(&transfers[n_transfers], 0, sizeof(transfers[n_transfers]));
+	    transfers[n_transfers].tx_buf = (unsigned long)data;
+	    transfers[n_transfers].len = len;
+	    transfers[n_transfers].speed_hz = speed;
+	    n_transfers++;
+
+	    msg_total += len;
+	    data += len;
+	    remaining -= len;
+	  }
+	}
+
+	if(n_transfers != 0 && submit_transfers(n_transfers, cmd) == -1)
+	  status = -1;
+
+	return status;
+}
+
+
+/**
+ * @brief Sends the same pattern "repetitions" times as one continuous stream without reading the response. Used to fill
+ *        regions with a solid color without building the whole stream in memory.
+ *
+ * @param[in] pattern The bytes to repeat.
+ * @param[in] pattern_size The number of bytes of the pattern.
+ * @param[in] repetitions The number of times the pattern is sent.
+ * @param[in] cmd If true, the data sent is a command, if false, it is normal data.
+ * @param[in] speed Speed of the SPI link.
+ *
+ * @return 0 if success, -1 if error.
+ */
+int SPI_Master::send_spi_fill(const uint8_t pattern[], int pattern_size, long repetitions, uint8_t cmd, int speed){
+
+	SPI_SEGMENT segments[max_transfers_per_msg];
+
+	if(pattern_size <= 0 || pattern_size > fill_buffer_size)
+	  return -1;
+
+	int patterns_per_buffer = fill_buffer_size / pattern_size;
+	for(int i = 0; i < patterns_per_buffer; i++)
+	  memcpy(fill_buffer + i * pattern_size, pattern, pattern_size);
+
+	int status = 0;
+	while(repetitions > 0){
+	  int n_segments = 0;
+
+	  while(repetitions > 0 && n_segments < max_transfers_per_msg){
+	    long reps = std::min(repetitions, (long)patterns_per_buffer);
+	    segments[n_segments].data = fill_buffer;
+	    segments[n_segments].size = reps * pattern_size;
+	    n_segments++;
+	    repetitions -= reps;
+	  }
+
+	  if(send_spi_segments(segments, n_segments, cmd, speed) == -1)
+	    status = -1;
+	}
+
+	return status;
+}
+
+
+/**
+ * @brief Obtain the maximum number of bytes that can be sent in one ioctl call. It is the spidev "bufsiz" module
+ *        parameter, read when the device is started.
+ *
+ * @return The maximum number of bytes per ioctl call.
+ */
+int SPI_Master::get_max_transfer_size(){
+	return bufsiz;
+}
+
+
+/**
+ * @brief Obtain the statistics of the SPI link. They are always recorded and can be read from any thread.
+ *
+ * @param[out] stats Where the statistics are copied.
+ */
+void SPI_Master::get_spi_stats(SPI_STATS *stats){
+	copy_phase_stats(command_counters, &stats->command);
+	copy_phase_stats(data_counters, &stats->data);
+	stats->dc_changes = dc_changes.load(std::memory_order_relaxed);
+}
+
+
+/**
+ * @brief Sets all the statistics of the SPI link to 0.
+ */
+void SPI_Master::reset_spi_stats(){
+	reset_phase_counters(command_counters);
+	reset_phase_counters(data_counters);
+	dc_changes.store(0, std::memory_order_relaxed);
+}
+
+
+/**
+ * @brief Writes the statistics of the SPI link as text, one line per phase prefixed with the spidev device.
+ *        Only uses async-signal-safe functions, so it can be called from a signal handler.
+ *
+ * @param[in] fd The file descriptor where the text is written.
+ *
+ * @return 0 if success, -1 if error.
+ */
+int SPI_Master::print_spi_stats(int fd){
+	SPI_STATS stats;
+	get_spi_stats(&stats);
+
+	if(write_phase_stats(fd, spi_device, "command", stats.command) == -1 ||
+	    write_phase_stats(fd, spi_device, "data", stats.data) == -1 ||
+	    write_text(fd, "SPI spidev0.") == -1 || write_number(fd, spi_device) == -1 ||
+	    write_text(fd, " dc_changes=") == -1 || write_number(fd, stats.dc_changes) == -1 ||
+	    write_text(fd, "\n") == -1)
+	  return -1;
+
+	return 0;
+}
+
+
+/**
+ * @brief Installs a handler that writes the statistics of every SPI link to stderr every time the process receives
+ *        the signal "signum" (e.g. "kill -USR1 <pid>").
+ *
+ * @param[in] signum The signal.
+ *
+ * @return 0 if success, -1 if error.
+ */
+int SPI_Master::enable_spi_stats_signal(int signum){
+	struct sigaction action;
+
+	memset(&action, 0, sizeof(action));
+	action.sa_handler = stats_signal_handler;
+	action.sa_flags = SA_RESTART;
+	sigemptyset(&action.sa_mask);
+
+	return sigaction(signum, &action, NULL);
+}
+
+
 /**
  * @brief End SPI communications and free all the related resources.
  *
  * @return 0 if success, -1 if error.
  */
 int SPI_Master::spi_end(){
+	for(int i = 0; i < max_links; i++){
+	  SPI_Master *expected = this;
+	  started_links[i].compare_exchange_strong(expected, NULL);
+	}
+
+	//A handler that has already loaded this link must finish before the link is freed
+	while(running_handlers.load() != 0)
+	  sched_yield();
+
 	int status = close(fd);
 	if(status != -1){
 	fd = 0;
 	}
-	gpio17.~GPIO();
+	dc_line.reset();
 
 	return status;
 }
+
+
+/* Private functions ---------------------------------------------------------*/
+/**
+ * @brief Sets the DC pin to indicate if the following bytes are a command or normal data. The pin is only
+ *        written when the type changes.
+ *
+ * @param[in] cmd If true, the following bytes are a command, if false, they are normal data.
+ */
+void SPI_Master::set_dc_line(uint8_t cmd){
+	if(previous_cmd != cmd){
+	  previous_cmd = cmd;
+	  dc_line->write(!cmd);
+	  dc_changes.fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+
+/**
+ * @brief Sends the first "count" transfers of the transfers array in one ioctl call.
+ *
+ * @param[in] count The number of transfers to send.
+ * @param[in] cmd If true, the data sent is a command, if false, it is normal data.
+ *
+ * @return 0 if success, -1 if error.
+ */
+int SPI_Master::submit_transfers(int count, uint8_t cmd){
+	long bytes = 0;
+	for(int i = 0; i < count; i++)
+	  bytes += transfers[i].len;
+
+	int64_t start_ns = get_time_ns();
+	int ret = ioctl(fd, SPI_IOC_MESSAGE(count), transfers);
+	record_message(cmd, count, bytes, get_time_ns() - start_ns, ret == -1);
+
+	if(ret == -1){
+		fprintf(stderr,"ERROR: Error in SPI transmission. Couldn't perform. Error description: %s\n", strerror(errno));
+		return -1;
+	}
+	return 0;
+}
+
+
+/**
+ * @brief Obtain the time of the monotonic clock.
+ *
+ * @return The time in nanoseconds.
+ */
+static int64_t get_time_ns(){
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (int64_t)now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+
+/**
+ * @brief Adds one ioctl call to the statistics of its phase.
+ *
+ * @param[in] cmd If true, the message was a command, if false, it was normal data.
+ * @param[in] n_transfers The number of transfers of the message.
+ * @param[in] bytes The number of bytes of the message.
+ * @param[in] elapsed_ns The time spent in the ioctl call.
+ * @param[in] error True if the ioctl call failed.
+ */
+void SPI_Master::record_message(uint8_t cmd, int n_transfers, long bytes, int64_t elapsed_ns, bool error){
+	PHASE_COUNTERS &counters = cmd ? command_counters : data_counters;
+
+	//Bucket 0 is [0, 1) us and bucket i is [2^(i-1), 2^i) us
+	int bucket = 0;
+	for(uint64_t us = elapsed_ns / 1000; us != 0 && bucket < latency_buckets - 1; us >>= 1)
+	  bucket++;
+
+	counters.messages.fetch_add(1, std::memory_order_relaxed);
+	counters.transfers.fetch_add(n_transfers, std::memory_order_relaxed);
+	counters.bytes.fetch_add(bytes, std::memory_order_relaxed);
+	counters.busy_ns.fetch_add(elapsed_ns, std::memory_order_relaxed);
+	counters.latency_histogram[bucket].fetch_add(1, std::memory_order_relaxed);
+	if(error)
+	  counters.errors.fetch_add(1, std::memory_order_relaxed);
+}
+
+
+/**
+ * @brief Copies the counters of one phase.
+ *
+ * @param[in] counters The counters of the phase.
+ * @param[out] stats Where the counters are copied.
+ */
+void SPI_Master::copy_phase_stats(const PHASE_COUNTERS &counters, SPI_PHASE_STATS *stats){
+	stats->messages = counters.messages.load(std::memory_order_relaxed);
+	stats->transfers = counters.transfers.load(std::memory_order_relaxed);
+	stats->bytes = counters.bytes.load(std::memory_order_relaxed);
+	stats->errors = counters.errors.load(std::memory_order_relaxed);
+	stats->busy_ns = counters.busy_ns.load(std::memory_order_relaxed);
+	for(int i = 0; i < latency_buckets; i++)
+	  stats->latency_histogram[i] = counters.latency_histogram[i].load(std::memory_order_relaxed);
+}
+
+
+/**
+ * @brief Sets the counters of one phase to 0.
+ *
+ * @param[in] counters The counters of the phase.
+ */
+void SPI_Master::reset_phase_counters(PHASE_COUNTERS &counters){
+	counters.messages.store(0, std::memory_order_relaxed);
+	counters.transfers.store(0, std::memory_order_relaxed);
+	counters.bytes.store(0, std::memory_order_relaxed);
+	counters.errors.store(0, std::memory_order_relaxed);
+	counters.busy_ns.store(0, std::memory_order_relaxed);
+	for(int i = 0; i < latency_buckets; i++)
+	  counters.latency_histogram[i].store(0, std::memory_order_relaxed);
+}
+
+
+/**
+ * @brief Writes the statistics of one phase as a line of text with the format
+ *        "SPI spidev0.<device> <name> messages=<n> transfers=<n> bytes=<n> errors=<n> busy_us=<n>
+ *        latency_us=<n>/<n>/.../<n>", where the latency values are the buckets of the histogram.
+ *
+ * @param[in] fd The file descriptor where the text is written.
+ * @param[in] spi_device The number of the spidev device of the link.
+ * @param[in] name The name of the phase.
+ * @param[in] stats The statistics of the phase.
+ *
+ * @return 0 if success, -1 if error.
+ */
+static int write_phase_stats(int fd, int spi_device, const char name[], const SPI_PHASE_STATS &stats){
+	if(write_text(fd, "SPI spidev0.") == -1 || write_number(fd, spi_device) == -1 ||
+	    write_text(fd, " ") == -1 || write_text(fd, name) == -1 ||
+	    write_text(fd, " messages=") == -1 || write_number(fd, stats.messages) == -1 ||
+	    write_text(fd, " transfers=") == -1 || write_number(fd, stats.transfers) == -1 ||
+	    write_text(fd, " bytes=") == -1 || write_number(fd, stats.bytes) == -1 ||
+	    write_text(fd, " errors=") == -1 || write_number(fd, stats.errors) == -1 ||
+	    write_text(fd, " busy_us=") == -1 || write_number(fd, stats.busy_ns / 1000) == -1 ||
+	    write_text(fd, " latency_us=") == -1)
+	  return -1;
+
+	for(int i = 0; i < latency_buckets; i++){
+	  if((i != 0 && write_text(fd, "/") == -1) || write_number(fd, stats.latency_histogram[i]) == -1)
+	    return -1;
+	}
+
+	return write_text(fd, "\n");
+}
+
+
+/**
+ * @brief Writes a null-terminated string with the write system call, which is async-signal-safe.
+ *
+ * @param[in] fd The file descriptor where the text is written.
+ * @param[in] text The string.
+ *
+ * @return 0 if success, -1 if error.
+ */
+static int write_text(int fd, const char text[]){
+	size_t remaining = strlen(text);
+
+	while(remaining > 0){
+	  ssize_t written = write(fd, text, remaining);
+	  if(written == -1){
+	    if(errno == EINTR)
+	      continue;
+	    return -1;
+	  }
+	  text += written;
+	  remaining -= written;
+	}
+
+	return 0;
+}
+
+
+/**
+ * @brief Writes a number in decimal without using printf, which is not async-signal-safe.
+ *
+ * @param[in] fd The file descriptor where the text is written.
+ * @param[in] number The number.
+ *
+ * @return 0 if success, -1 if error.
+ */
+static int write_number(int fd, uint64_t number){
+	char digits[21];
+	int pos = sizeof(digits) - 1;
+
+	digits[pos] = '\0';
+	do{
+	  digits[--pos] = '0' + number % 10;
+	  number /= 10;
+	}while(number != 0);
+
+	return write_text(fd, digits + pos);
+}
+
+
+/**
+ * @brief Handler of the signal installed with enable_spi_stats_signal. Dumps the statistics of every started
+ *        link to stderr.
+ *
+ * @param[in] signum The received signal.
+ */
+static void stats_signal_handler(int signum){
+	int saved_errno = errno;
+	running_handlers++;   //Before loading the links, so spi_end waits for this handler if it has seen the link
+	for(int i = 0; i < max_links; i++){
+	  SPI_Master *link = started_links[i].load();
+	  if(link != NULL)
+	    link->print_spi_stats(STDERR_FILENO);
+	}
+	running_handlers--;
+	errno = saved_errno;
+}
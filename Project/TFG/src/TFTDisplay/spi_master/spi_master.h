@@ -27,53 +27,204 @@
 #include <linux/spi/spidev.h>
 #include <errno.h>
 
+#ifdef __cplusplus
+#include <atomic>
+#include <memory>
+
+namespace CustomGPIO{
+  class GPIO;
+}
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
   /* Exported variables --------------------------------------------------------*/
   /* Exported types ------------------------------------------------------------*/
+  /**
+   * Contiguous block of bytes to be sent as part of a bulk SPI transmission.
+   */
+  typedef struct{
+    const uint8_t *data;
+    int size;
+  }SPI_SEGMENT;
+
+  /**
+   * Statistics of the SPI messages sent with the DC line in one state (commands or data). Every ioctl call is a
+   * message, that can carry several transfers. The latency of every message is accumulated in "busy_ns" and
+   * counted in "latency_histogram": bucket 0 counts messages shorter than 1 us, bucket i counts messages of
+   * [2^(i-1), 2^i) us and the last bucket counts all the longer ones.
+   */
+  typedef struct{
+    uint64_t messages;
+    uint64_t transfers;
+    uint64_t bytes;
+    uint64_t errors;
+    uint64_t busy_ns;
+    uint64_t latency_histogram[16];
+  }SPI_PHASE_STATS;
+
+  /**
+   * Statistics of the SPI link since the program started or since the last reset.
+   */
+  typedef struct{
+    SPI_PHASE_STATS command;
+    SPI_PHASE_STATS data;
+    uint64_t dc_changes;      //Writes of the DC pin
+  }SPI_STATS;
   /* Exported constants --------------------------------------------------------*/
   /* Exported macro ------------------------------------------------------------*/
   /* Exported Functions --------------------------------------------------------*/
 
 #ifdef __cplusplus
-    namespace SPI_Master{
-#endif
-      /**
-       * @brief Starts the SPI device and configures it to allow SPI communications.
-       * 
-       * @param[in] spi_device Indicates which SPI device of type spidev0.<number>
-       *                       within the /dev/ directory will be used.
-       *
-       * @return 0 if success, -1 if error.
-       */
-      int spi_start (int spi_device, int mode, int bits, int speed);
-
-      /**
-       * @brief It sends SPI data of length "size" to the other SPI end, at a speed "speed" and with a delay time "delay" after the data is sent.
-       *        The response is stored in the rx buffer. To differentiate between normal data and commands, the GPIO17 pin will be enabled or
-       *        disabled. This will be indicated by the parameter "cmd".
-       *
-       * @param[in] messages Pointer to the SPI data to send.
-       * @param[in] rx Pointer to the array where the response will be stored.
-       * @param[in] cmd If true, the data sent is a command, if false, it is normal data.
-       * @param[in] size The size of the data sent.
-       * @param[in] speed Speed of the SPI link.
-       *
-       */
-      void send_spi_msg (uint8_t* messages, uint8_t rx[], uint8_t cmd, int size, int delay, int speed);
-
-      /**
-       * @brief End SPI communications and free all the related resources.
-       * 
-       * @return 0 if success, -1 if error.
-       */
-      int spi_end();
-
-#ifdef __cplusplus 
-    }
+  /**
+   * SPI link with one panel: a spidev device and the GPIO that drives the DC line of the panel. Every
+   * instance has its own buffers and statistics, so several panels can be used from different threads.
+   */
+  class SPI_Master{
+    //Counters of one phase. Only the thread that sends to the panel writes them. They are atomic so they
+    //can be read from any thread or signal handler.
+    struct PHASE_COUNTERS{
+      std::atomic<uint64_t> messages, transfers, bytes, errors, busy_ns;
+      std::atomic<uint64_t> latency_histogram[sizeof(SPI_PHASE_STATS::latency_histogram) / sizeof(uint64_t)];
+    };
+
+    static constexpr int max_transfers_per_msg = 64;
+    static constexpr int fill_buffer_size = 512;
+
+    int dc_pin;
+    int spi_device;
+    int fd;
+    std::unique_ptr<CustomGPIO::GPIO> dc_line;
+    bool previous_cmd;
+    int bufsiz;
+    struct spi_ioc_transfer tr;
+    struct spi_ioc_transfer transfers[max_transfers_per_msg];
+    uint8_t fill_buffer[fill_buffer_size];
+    PHASE_COUNTERS command_counters, data_counters;
+    std::atomic<uint64_t> dc_changes;
+
+    void set_dc_line(uint8_t cmd);
+    int submit_transfers(int count, uint8_t cmd);
+    void record_message(uint8_t cmd, int n_transfers, long bytes, int64_t elapsed_ns, bool error);
+    static void copy_phase_stats(const PHASE_COUNTERS &counters, SPI_PHASE_STATS *stats);
+    static void reset_phase_counters(PHASE_COUNTERS &counters);
+  public:
+
+    /**
+     * @brief Class constructor. Sets the GPIO of the DC line. Nothing is opened until spi_start is called.
+     *
+     * @param[in] dc_pin The GPIO connected to the DC pin of the panel.
+     */
+    SPI_Master(int dc_pin);
+
+    /**
+     * @brief Class destructor. Ends the SPI communications if they are still started.
+     */
+    ~SPI_Master();
+
+    /**
+     * @brief Starts the SPI device and configures it to allow SPI communications. If the device can't be configured,
+     *        it is closed again. Only the first 8 started links are dumped by the statistics signal handler.
+     *
+     * @param[in] spi_device Indicates which SPI device of type spidev0.<number>
+     *                       within the /dev/ directory will be used.
+     *
+     * @return 0 if success, -1 if error.
+     */
+    int spi_start (int spi_device, int mode, int bits, int speed);
+
+    /**
+     * @brief It sends SPI data of length "size" to the other SPI end, at a speed "speed" and with a delay time "delay" after the data is sent.
+     *        The response is stored in the rx buffer. To differentiate between normal data and commands, the DC pin will be enabled or
+     *        disabled. This will be indicated by the parameter "cmd".
+     *
+     * @param[in] messages Pointer to the SPI data to send.
+     * @param[in] rx Pointer to the array where the response will be stored, or NULL to ignore the response.
+     * @param[in] cmd If true, the data sent is a command, if false, it is normal data.
+     * @param[in] size The size of the data sent.
+     * @param[in] speed Speed of the SPI link.
+     *
+     */
+    void send_spi_msg (uint8_t* messages, uint8_t rx[], uint8_t cmd, int size, int delay, int speed);
+
+    /**
+     * @brief Sends a group of data blocks as one continuous stream without reading the response. The blocks are packed into
+     *        as few ioctl calls as possible: every call carries several transfers whose total size doesn't exceed the spidev
+     *        buffer size, and blocks larger than that are split across calls.
+     *
+     * @param[in] segments The data blocks to send, in order.
+     * @param[in] count The number of blocks.
+     * @param[in] cmd If true, the data sent is a command, if false, it is normal data.
+     * @param[in] speed Speed of the SPI link.
+     *
+     * @return 0 if success, -1 if error.
+     */
+    int send_spi_segments (const SPI_SEGMENT segments[], int count, uint8_t cmd, int speed);
+
+    /**
+     * @brief Sends the same pattern "repetitions" times as one continuous stream without reading the response. Used to fill
+     *        regions with a solid color without building the whole stream in memory.
+     *
+     * @param[in] pattern The bytes to repeat.
+     * @param[in] pattern_size The number of bytes of the pattern.
+     * @param[in] repetitions The number of times the pattern is sent.
+     * @param[in] cmd If true, the data sent is a command, if false, it is normal data.
+     * @param[in] speed Speed of the SPI link.
+     *
+     * @return 0 if success, -1 if error.
+     */
+    int send_spi_fill (const uint8_t pattern[], int pattern_size, long repetitions, uint8_t cmd, int speed);
+
+    /**
+     * @brief Obtain the maximum number of bytes that can be sent in one ioctl call. It is the spidev "bufsiz" module
+     *        parameter, read when the device is started.
+     *
+     * @return The maximum number of bytes per ioctl call.
+     */
+    int get_max_transfer_size ();
+
+    /**
+     * @brief Obtain the statistics of the SPI link. They are always recorded and can be read from any thread.
+     *
+     * @param[out] stats Where the statistics are copied.
+     */
+    void get_spi_stats (SPI_STATS *stats);
+
+    /**
+     * @brief Sets all the statistics of the SPI link to 0.
+     */
+    void reset_spi_stats ();
+
+    /**
+     * @brief Writes the statistics of the SPI link as text, one line per phase prefixed with the spidev device.
+     *        Only uses async-signal-safe functions, so it can be called from a signal handler.
+     *
+     * @param[in] fd The file descriptor where the text is written.
+     *
+     * @return 0 if success, -1 if error.
+     */
+    int print_spi_stats (int fd);
+
+    /**
+     * @brief Installs a handler that writes the statistics of every SPI link to stderr every time the process receives
+     *        the signal "signum" (e.g. "kill -USR1 <pid>").
+     *
+     * @param[in] signum The signal.
+     *
+     * @return 0 if success, -1 if error.
+     */
+    static int enable_spi_stats_signal (int signum);
+
+    /**
+     * @brief End SPI communications and free all the related resources.
+     *
+     * @return 0 if success, -1 if error.
+     */
+    int spi_end();
+  };
 #endif
-    
+
 #ifdef __cplusplus
 }
 #endif
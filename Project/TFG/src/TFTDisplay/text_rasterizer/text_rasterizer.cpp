@@ -0,0 +1,143 @@
+/**
+  ******************************************************************************
+  * @file   text_rasterizer.cpp
+  * @author Pablo San Millán Fierro (pablo.sanmillanf@alumnos.upm.es)
+  * @brief  Scanline text rasterizer Module.
+  *
+  * @note   End-of-degree work.
+  *         This module converts a string into RGB565 pixels one row at a
+  *         time, directly from the Font glyph bitmaps, so a string of any
+  *         length can be drawn without building its whole bitmap.
+  ******************************************************************************
+*/
+
+/* Includes ------------------------------------------------------------------*/
+#include "text_rasterizer.h" // Module header
+#include "../mono_expand/mono_expand.h"
+#include <string.h>
+#include <algorithm>
+
+/* Private defines -----------------------------------------------------------*/
+/* Private typedef -----------------------------------------------------------*/
+/* Private variables----------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static bool in_font(const Font &font, char c);
+/* Functions -----------------------------------------------------------------*/
+
+/**
+ * @brief Class constructor. Measures the string. The string and the font must remain valid while the
+ *        rasterizer is used.
+ *
+ * @param[in] str The string. Characters without a glyph in the font are ignored.
+ * @param[in] font font of the text.
+ * @param[in] color Color of the text, in the same byte order used in the SPI messages.
+ * @param[in] background Color of the rest of the bounding box of the text.
+ */
+TextRasterizer::TextRasterizer(const char str[], const Font &font, uint16_t color, uint16_t background):
+    str(str), length(strlen(str)), font(font), color(color), background(background), width(0),
+    y_offset(-font.ascent), height(font.ascent + font.descent), overlapping(false){
+
+  for(size_t i = 0; i < length; i++){
+    if(!in_font(font, str[i]))
+      continue;
+
+    const FontGlyph &glyph = font.glyph[(uint8_t)str[i] - font.first];
+
+    width += glyph.x_advance;
+    overlapping |= !glyph.inside_cell;
+  }
+}
+
+
+/**
+ * @brief Obtain the width of the bounding box of the text: the sum of the advances of its glyphs.
+ *
+ * @return The width in pixels.
+ */
+int TextRasterizer::get_width() const{
+  return width;
+}
+
+
+/**
+ * @brief Obtain the number of pixels from the line where the text is written to the uppermost row of
+ *        the bounding box of the text: minus the ascent of the font.
+ *
+ * @return The offset in pixels.
+ */
+int TextRasterizer::get_y_offset() const{
+  return y_offset;
+}
+
+
+/**
+ * @brief Obtain the height of the bounding box of the text: the ascent plus the descent of the font, so
+ *        every string of a font has the same height.
+ *
+ * @return The height in pixels.
+ */
+int TextRasterizer::get_height() const{
+  return height;
+}
+
+
+/**
+ * @brief Renders some columns of one row of the bounding box of the text. Glyphs that stay inside their
+ *        advance cell are drawn with their background and the ones that overlap a neighbour only draw
+ *        their shape, so they don't erase the neighbour.
+ *
+ * @param[in] row The row, from 0 to get_height() - 1.
+ * @param[in] first_column The first column to render, from 0.
+ * @param[in] end_column The column after the last one to render, up to get_width().
+ * @param[out] pixels Where the end_column - first_column pixels are written.
+ */
+void TextRasterizer::render_row(int row, int first_column, int end_column, uint16_t pixels[]) const{
+  std::fill(pixels, pixels + (end_column - first_column), background);
+
+  //The glyphs that overlap a neighbour are drawn in a second pass, over the cells of the first one
+  for(int pass = 0; pass < (overlapping ? 2 : 1); pass++){
+    int cell_x = 0;
+
+    for(size_t i = 0; i < length; i++){
+      if(!in_font(font, str[i]))
+        continue;
+
+      const FontGlyph &glyph = font.glyph[(uint8_t)str[i] - font.first];
+      int glyph_x = cell_x + glyph.x_offset;
+      int glyph_row = row + y_offset - glyph.y_offset;
+
+      cell_x += glyph.x_advance;
+
+      if(glyph.inside_cell != (pass == 0) || glyph_row < 0 || glyph_row >= glyph.height)
+        continue;
+
+      int first = std::max(first_column, glyph_x);
+      int end = std::min(end_column, glyph_x + glyph.width);
+      if(first >= end)
+        continue;
+
+      //Every glyph row starts at a byte boundary, so whole rows are expanded a byte at a time
+      const uint8_t *row_bits = font.bitmap + glyph.bitmap_offset + glyph_row * ((glyph.width + 7) / 8);
+      int first_bit = first - glyph_x;
+      uint16_t *dst = pixels + (first - first_column);
+
+      if(glyph.inside_cell){
+        MonoExpand::expand(row_bits, first_bit, end - first, color, background, dst);
+        continue;
+      }
+      for(int bit = first_bit; bit < end - glyph_x; bit++, dst++){
+        if(row_bits[bit / 8] & (0x80 >> (bit % 8)))
+          *dst = color;
+      }
+    }
+  }
+}
+
+
+/* Private functions ---------------------------------------------------------*/
+/**
+ * @brief Checks if a character has a glyph in the font.
+ */
+static bool in_font(const Font &font, char c){
+  return (uint8_t)c >= font.first && (uint8_t)c <= font.last;
+}
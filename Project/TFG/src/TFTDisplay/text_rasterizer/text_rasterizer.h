@@ -0,0 +1,88 @@
+/**
+  ******************************************************************************
+  * @file   text_rasterizer.h
+  * @author Pablo San Millán Fierro (pablo.sanmillanf@alumnos.upm.es)
+  * @brief  Scanline text rasterizer Module Header.
+  *
+  * @note   End-of-degree work.
+  *         This module converts a string into RGB565 pixels one row at a
+  *         time, directly from the Font glyph bitmaps, so a string of any
+  *         length can be drawn without building its whole bitmap.
+  ******************************************************************************
+*/
+
+#ifndef __TEXT_RASTERIZER_H__
+#define __TEXT_RASTERIZER_H__
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <stddef.h>
+#include "../fonts/font.h"
+
+/* Exported types ------------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported Classes ----------------------------------------------------------*/
+
+class TextRasterizer{
+  const char *str;
+  size_t length;
+  const Font &font;
+  uint16_t color;
+  uint16_t background;
+  int width;
+  int y_offset;
+  int height;
+  bool overlapping;   //True if a glyph of the string overlaps a neighbour cell
+public:
+
+  /**
+   * @brief Class constructor. Measures the string. The string and the font must remain valid while the
+   *        rasterizer is used.
+   *
+   * @param[in] str The string. Characters without a glyph in the font are ignored.
+   * @param[in] font font of the text.
+   * @param[in] color Color of the text, in the same byte order used in the SPI messages.
+   * @param[in] background Color of the rest of the bounding box of the text.
+   */
+  TextRasterizer(const char str[], const Font &font, uint16_t color, uint16_t background);
+
+  /**
+   * @brief Obtain the width of the bounding box of the text: the sum of the advances of its glyphs.
+   *
+   * @return The width in pixels.
+   */
+  int get_width() const;
+
+  /**
+   * @brief Obtain the number of pixels from the line where the text is written to the uppermost row of
+   *        the bounding box of the text: minus the ascent of the font.
+   *
+   * @return The offset in pixels.
+   */
+  int get_y_offset() const;
+
+  /**
+   * @brief Obtain the height of the bounding box of the text: the ascent plus the descent of the font, so
+   *        every string of a font has the same height.
+   *
+   * @return The height in pixels.
+   */
+  int get_height() const;
+
+  /**
+   * @brief Renders some columns of one row of the bounding box of the text. Glyphs that stay inside their
+   *        advance cell are drawn with their background and the ones that overlap a neighbour only draw
+   *        their shape, so they don't erase the neighbour.
+   *
+   * @param[in] row The row, from 0 to get_height() - 1.
+   * @param[in] first_column The first column to render, from 0.
+   * @param[in] end_column The column after the last one to render, up to get_width().
+   * @param[out] pixels Where the end_column - first_column pixels are written.
+   */
+  void render_row(int row, int first_column, int end_column, uint16_t pixels[]) const;
+};
+
+/* Exported Functions --------------------------------------------------------*/
+
+#endif /* __TEXT_RASTERIZER_H__ */
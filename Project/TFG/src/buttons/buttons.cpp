@@ -12,16 +12,22 @@
 /* Includes ------------------------------------------------------------------*/
 #include "buttons.h" // Module header
 #include <atomic>
+#include <chrono>
 
 /* External variables---------------------------------------------------------*/
 SyncQueue<Buttons::BUTTON> Buttons::buttonsQueue;
 
 /* Private defines -----------------------------------------------------------*/
 /* Private typedef -----------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+static long now_ms();
+static void push_pulse(Buttons::BUTTON pulse);
 /* Private variables----------------------------------------------------------*/
 static std::atomic_bool run = true;
 static int regular_wait_time = 200;
-/* Private function prototypes -----------------------------------------------*/
+static std::atomic<long> last_pulse_ms(now_ms());   //Time of the last pulse, from the steady clock epoch. It
+                                                    //starts at the program start, so the idle time doesn't
+                                                    //depend on when the buttons thread is scheduled
 /* Functions -----------------------------------------------------------------*/
 
 /**
@@ -73,11 +79,11 @@ void Buttons::buttons_thread(bool active_state, int long_pulse, int up_pin, int
 
         aux = CustomGPIO::GPIO::waits(gpios, 5, long_pulse);
         if(aux == -2){  //If timeout
-          buttonsQueue.push((Buttons::BUTTON){(Buttons::BUTTON_SYMBOL)current_active, Buttons::LONG_PULSE});
+          push_pulse((Buttons::BUTTON){(Buttons::BUTTON_SYMBOL)current_active, Buttons::LONG_PULSE});
           state = LONG_PULSE;
         }
         else if(current_active == aux && active_state != gpios[current_active].read()){
-          buttonsQueue.push((Buttons::BUTTON){(Buttons::BUTTON_SYMBOL)current_active, Buttons::SHORT_PULSE});
+          push_pulse((Buttons::BUTTON){(Buttons::BUTTON_SYMBOL)current_active, Buttons::SHORT_PULSE});
           state = IDLE;
         }
         break;
@@ -85,7 +91,7 @@ void Buttons::buttons_thread(bool active_state, int long_pulse, int up_pin, int
 
         if(current_active == CustomGPIO::GPIO::waits(gpios, 5, regular_wait_time) &&
             active_state != gpios[current_active].read()){
-          buttonsQueue.push((Buttons::BUTTON){(Buttons::BUTTON_SYMBOL)current_active, Buttons::LONG_PULSE_RELEASED});
+          push_pulse((Buttons::BUTTON){(Buttons::BUTTON_SYMBOL)current_active, Buttons::LONG_PULSE_RELEASED});
           state = IDLE;
         }
         break;
@@ -95,6 +101,17 @@ void Buttons::buttons_thread(bool active_state, int long_pulse, int up_pin, int
 }
 
 
+/**
+ * @brief Obtain the time since the last pulse was pushed to buttonsQueue or, if there hasn't been any pulse,
+ *        since the program started.
+ *
+ * @return The time in milliseconds.
+ */
+long Buttons::get_idle_time_ms(){
+  return now_ms() - last_pulse_ms;
+}
+
+
 /**
  * @brief This function is used to finish the buttons handler thread correctly. The termination is
  *        not instantaneous and after this function the join() function of the thread in question
@@ -104,3 +121,27 @@ void Buttons::buttons_thread(bool active_state, int long_pulse, int up_pin, int
 void Buttons::buttons_thread_finisher(){
   run = false;
 }
+
+
+
+/* Private functions ---------------------------------------------------------*/
+/**
+ * @brief Obtain the time of the steady clock.
+ *
+ * @return The time in milliseconds since the steady clock epoch.
+ */
+static long now_ms(){
+  return std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+
+/**
+ * @brief Pushes a pulse to buttonsQueue and remembers when it happened.
+ *
+ * @param[in] pulse The pulse.
+ */
+static void push_pulse(Buttons::BUTTON pulse){
+  last_pulse_ms = now_ms();
+  Buttons::buttonsQueue.push(pulse);
+}
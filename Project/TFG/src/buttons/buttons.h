@@ -54,6 +54,15 @@ extern SyncQueue<BUTTON> buttonsQueue;
 void buttons_thread(bool active_state, int long_pulse, int up_pin, int down_pin, int left_pin, int right_pin, int center_pin);
 
 
+/**
+ * @brief Obtain the time since the last pulse was pushed to buttonsQueue or, if there hasn't been any pulse,
+ *        since the program started.
+ *
+ * @return The time in milliseconds.
+ */
+long get_idle_time_ms();
+
+
 /**
  * @brief This function is used to finish the buttons handler thread correctly. The termination is
  *        not instantaneous and after this function the join() function of the thread in question
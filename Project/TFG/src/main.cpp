@@ -2,8 +2,10 @@
 #include <stdio.h>
 #include <stdint.h>
 #include "TFTDisplay/TFTDisplay.h"
+#include "TFTDisplay/spi_master/spi_master.h"
 #include "app_data_storage/app_data_storage.h"
 #include "measures/measures.h"
+#include "measures/OrientationTracker/OrientationTracker.h"
 #include "client_MQTT/client_MQTT.h"
 #include "buttons/buttons.h"
 #include <chrono>
@@ -13,13 +15,14 @@
 #include <ctime>
 #include <sstream>
 #include <csignal>
+#include <memory>
 
 #define __BUILDROOT_CONF__
 
 void finisher(int signal);
 
 void main_menu_handler(std::function<void()> right_fn, std::function<void()> left_fn,
-    std::function<void()> down_fn, bool timeout);
+    std::function<void()> down_fn, std::function<void()> up_fn, bool timeout);
 
 std::string get_time();
 
@@ -35,6 +38,10 @@ int text_list_menu(std::string title, std::vector<std::string> list, uint32_t lo
 
 void pulse_action(Buttons::BUTTON previous_pulsed, uint32_t us_cycle, std::function<void ()> action);
 
+void sleep_if_idle();
+
+bool wait_pulse(Buttons::BUTTON *data);
+
 std::vector<std::string> get_time_zone_list_and_index(std::string timezone_file_path, std::string tzs_directory_path,
     uint16_t *index);
 
@@ -45,19 +52,35 @@ std::vector<std::string> exec_cmd_and_get_lines(const char* cmd);
 const std::string HOST_IP_KEY = "HOST_IP";
 const std::string MQTT_TOKEN_KEY = "MQTT_TOKEN";
 const std::string TEMP_OFFSET_KEY = "TEMP_OFFSET";
+const std::string ROTATION_KEY = "ROTATION";
+const std::string AUTO_ROTATION_KEY = "AUTO_ROTATION";
+const std::string IDLE_TIMEOUT_KEY = "IDLE_TIMEOUT";
 const std::string default_host_ip = "192.168.000.001";
 const std::string default_mqtt_token = "00000000";
 const std::string default_temp_offset = "0";
+const std::string default_rotation = "0";         //Clockwise quarter turns. With auto rotation, mounting of the IMU
+const std::string default_auto_rotation = "0";    //"1" follows the orientation given by the accelerometer
+const std::string default_idle_timeout = "300";   //Seconds without pulses before the Display is turned off. "0" never
 
 const std::string tb_telemetry_topic = "v1/devices/me/telemetry";
 const std::string tb_attributes_topic = "v1/devices/me/attributes";
 
 const int wait_time_ms = 100;
 const int metric_period_s = 4 * 1000/wait_time_ms;
+const int idle_poll_ms = 1000;    //Period to check if the program has finished while waiting for a pulse
 
 const int min_temp = -10;
 const int max_temp = 50;
 
+//Charts of the main menus: minimum span of their scale and decimals of its values
+const float temp_chart_min_span = 1;
+const float hum_chart_min_span = 2;
+const float press_chart_min_span = 100;
+const float alt_chart_min_span = 10;
+const float iaq_chart_min_span = 10;
+const int chart_precision = 1;
+const std::string chart_span = std::to_string(Measures::history_samples * Measures::history_period_s / 60) + " min";
+
 const std::string timezone_file_path = "/etc/timezone";
 
 #ifdef __BUILDROOT_CONF__
@@ -80,12 +103,14 @@ const std::vector<std::string> conf_menus = {
     "Apagar"
 };
 std::atomic_bool run = true;
+long idle_timeout_ms = 0;   //Milliseconds without pulses before the Display is turned off. 0 never
 
 
 
 int main() {
 
   std::signal(SIGINT, finisher);
+  SPI_Master::enable_spi_stats_signal(SIGUSR1);   //"kill -USR1 <pid>" dumps the SPI statistics to stderr
 
   TFTDisplay::start();
 
@@ -97,8 +122,23 @@ int main() {
   std::string host_ip = storage.read_data_param(HOST_IP_KEY, default_host_ip);
   std::string mqtt_token = storage.read_data_param(MQTT_TOKEN_KEY, default_mqtt_token);
   float temp_offset = std::stof(storage.read_data_param(TEMP_OFFSET_KEY, default_temp_offset));
+  int rotation = std::stoi(storage.read_data_param(ROTATION_KEY, default_rotation)) & 3;
+  bool auto_rotation = storage.read_data_param(AUTO_ROTATION_KEY, default_auto_rotation) == "1";
+  idle_timeout_ms = std::stol(storage.read_data_param(IDLE_TIMEOUT_KEY, default_idle_timeout)) * 1000;
+
+  //The accelerometer shares the I2C bus with the BME688. The bus stays open until both sensors have ended
+  std::unique_ptr<OrientationTracker> orientation_tracker;
+  if(auto_rotation){
+    orientation_tracker.reset(new OrientationTracker(rotation, 100000, 5, [](int quarter_turns){
+      TFTDisplay::set_rotation((DISPLAY_ROTATION)quarter_turns);
+    }));
+    orientation_tracker->start();
+  }
+  else{
+    TFTDisplay::set_rotation((DISPLAY_ROTATION)rotation);
+  }
 
-  Measures::Meas meas(temp_offset, 100000);
+  Measures::Meas meas(temp_offset, 300000);
 
   meas.start_measures();
 
@@ -113,6 +153,18 @@ int main() {
 
   int top_border_conf_menu, bottom_border_conf_menu;
   bool change_menus = true;
+  bool show_charts = false;   //If true, the measure menus show the history chart instead of the last value
+  long chart_sequence = -1;   //Sequence of the last history sent to the chart
+
+  //Prints the chart of a history. If no sample has been added since the last time, nothing is printed
+  auto print_chart = [&](bool full_refresh, std::string title, MeasureHistory &history, float min_span) {
+    std::vector<float> samples;
+    long sequence = history.get_samples(&samples);
+
+    if(full_refresh || sequence != chart_sequence)
+      TFTDisplay::print_history_chart(full_refresh, title, chart_span, samples, sequence, min_span, chart_precision);
+    chart_sequence = sequence;
+  };
 
   //Menus configuration functions
   auto conf_fn = [&]() {
@@ -120,7 +172,7 @@ int main() {
     state = CONF;
     top_border_conf_menu = 0;
     bottom_border_conf_menu = TFTDisplay::max_conf_menus - 1;
-    TFTDisplay::print_conf_menu(true, true, conf_menus, 0, -1);
+    TFTDisplay::print_conf_menu(true, conf_menus, 0);
     std::this_thread::sleep_for(std::chrono::milliseconds(wait_time_ms));
   };
 
@@ -135,44 +187,61 @@ int main() {
   auto init_temp_fn = [&]() {
     cnt = 0;
     state = TEMP;
-    TFTDisplay::print_main_menu_temp(
-        true,
-        Measures::bme_data.temperature,
-        get_percentage(min_temp, max_temp, Measures::bme_data.temperature)
-        );
+    if(show_charts)
+      print_chart(true, "Temperatura", Measures::bme_history.temperature, temp_chart_min_span);
+    else
+      TFTDisplay::print_main_menu_temp(
+          true,
+          Measures::bme_data.temperature,
+          get_percentage(min_temp, max_temp, Measures::bme_data.temperature)
+          );
     std::this_thread::sleep_for(std::chrono::milliseconds(wait_time_ms));
   };
 
   auto init_hum_fn = [&]() {
     cnt = 0;
     state = HUM;
-    TFTDisplay::print_main_menu_hum(true, Measures::bme_data.humidity);
+    if(show_charts)
+      print_chart(true, "Humedad", Measures::bme_history.humidity, hum_chart_min_span);
+    else
+      TFTDisplay::print_main_menu_hum(true, Measures::bme_data.humidity);
     std::this_thread::sleep_for(std::chrono::milliseconds(wait_time_ms));
   };
 
   auto init_press_fn = [&]() {
     cnt = 0;
     state = PRESS;
-    TFTDisplay::print_main_menu_press(true, Measures::bme_data.pressure);
+    if(show_charts)
+      print_chart(true, "Presion", Measures::bme_history.pressure, press_chart_min_span);
+    else
+      TFTDisplay::print_main_menu_press(true, Measures::bme_data.pressure);
     std::this_thread::sleep_for(std::chrono::milliseconds(wait_time_ms));
   };
 
   auto init_alt_fn = [&]() {
     cnt = 0;
     state = ALT;
-    TFTDisplay::print_main_menu_alt(true, Measures::bme_data.altitude);
+    if(show_charts)
+      print_chart(true, "Altitud", Measures::bme_history.altitude, alt_chart_min_span);
+    else
+      TFTDisplay::print_main_menu_alt(true, Measures::bme_data.altitude);
     std::this_thread::sleep_for(std::chrono::milliseconds(wait_time_ms));
   };
 
   auto init_iaq_fn = [&]() {
     cnt = 0;
     state = IAQ;
-    TFTDisplay::print_main_menu_iaq(true, Measures::bme_data.iaq);
+    if(show_charts)
+      print_chart(true, "IAQ", Measures::bme_history.iaq, iaq_chart_min_span);
+    else
+      TFTDisplay::print_main_menu_iaq(true, Measures::bme_data.iaq);
     std::this_thread::sleep_for(std::chrono::milliseconds(wait_time_ms));
   };
 
   init_time_fn();
   while(run){
+    sleep_if_idle();
+
     switch(state){
       case TIME:
       {
@@ -184,17 +253,21 @@ int main() {
             init_temp_fn,
             init_iaq_fn,
             conf_fn,
+            [](){},   //The time has no chart
             ++cnt == metric_period_s && change_menus
         );
         break;
       }
       case TEMP:
       {
-        TFTDisplay::print_main_menu_temp(
-            false,
-            Measures::bme_data.temperature,
-            get_percentage(min_temp, max_temp, Measures::bme_data.temperature)
-            );
+        if(show_charts)
+          print_chart(false, "Temperatura", Measures::bme_history.temperature, temp_chart_min_span);
+        else
+          TFTDisplay::print_main_menu_temp(
+              false,
+              Measures::bme_data.temperature,
+              get_percentage(min_temp, max_temp, Measures::bme_data.temperature)
+              );
         std::this_thread::sleep_for(std::chrono::milliseconds(wait_time_ms));
 
 
@@ -202,65 +275,84 @@ int main() {
             init_hum_fn,
             init_time_fn,
             conf_fn,
+            [&](){ show_charts = !show_charts; init_temp_fn(); },
             ++cnt == metric_period_s && change_menus
         );
         break;
       }
       case HUM:
       {
-        TFTDisplay::print_main_menu_hum(false, Measures::bme_data.humidity);
+        if(show_charts)
+          print_chart(false, "Humedad", Measures::bme_history.humidity, hum_chart_min_span);
+        else
+          TFTDisplay::print_main_menu_hum(false, Measures::bme_data.humidity);
         std::this_thread::sleep_for(std::chrono::milliseconds(wait_time_ms));
 
         main_menu_handler(
             init_press_fn,
             init_temp_fn,
             conf_fn,
+            [&](){ show_charts = !show_charts; init_hum_fn(); },
             ++cnt == metric_period_s && change_menus
         );
         break;
       }
       case PRESS:
       {
-        TFTDisplay::print_main_menu_press(false, Measures::bme_data.pressure);
+        if(show_charts)
+          print_chart(false, "Presion", Measures::bme_history.pressure, press_chart_min_span);
+        else
+          TFTDisplay::print_main_menu_press(false, Measures::bme_data.pressure);
         std::this_thread::sleep_for(std::chrono::milliseconds(wait_time_ms));
 
         main_menu_handler(
             init_alt_fn,
             init_hum_fn,
             conf_fn,
+            [&](){ show_charts = !show_charts; init_press_fn(); },
             ++cnt == metric_period_s && change_menus
         );
         break;
       }
       case ALT:
       {
-        TFTDisplay::print_main_menu_alt(false, Measures::bme_data.altitude);
+        if(show_charts)
+          print_chart(false, "Altitud", Measures::bme_history.altitude, alt_chart_min_span);
+        else
+          TFTDisplay::print_main_menu_alt(false, Measures::bme_data.altitude);
         std::this_thread::sleep_for(std::chrono::milliseconds(wait_time_ms));
 
         main_menu_handler(
             init_iaq_fn,
             init_press_fn,
             conf_fn,
+            [&](){ show_charts = !show_charts; init_alt_fn(); },
             ++cnt == metric_period_s && change_menus
         );
         break;
       }
       case IAQ:
       {
-        TFTDisplay::print_main_menu_iaq(false, Measures::bme_data.iaq);
+        if(show_charts)
+          print_chart(false, "IAQ", Measures::bme_history.iaq, iaq_chart_min_span);
+        else
+          TFTDisplay::print_main_menu_iaq(false, Measures::bme_data.iaq);
         std::this_thread::sleep_for(std::chrono::milliseconds(wait_time_ms));
 
         main_menu_handler(
             init_time_fn,
             init_alt_fn,
             conf_fn,
+            [&](){ show_charts = !show_charts; init_iaq_fn(); },
             ++cnt == metric_period_s && change_menus
         );
         break;
       }
       case CONF:
       {
-        Buttons::BUTTON data = Buttons::buttonsQueue.pop();
+        Buttons::BUTTON data;
+        if(!Buttons::buttonsQueue.pop(&data, idle_poll_ms))
+          break;
 
         if(data.type != Buttons::LONG_PULSE_RELEASED){
           if(data.symbol == Buttons::RIGHT){
@@ -585,6 +677,7 @@ int main() {
                   TFTDisplay::print_centered_title("Apagando...", 2);
                   std::this_thread::sleep_for(std::chrono::seconds(1));
                   TFTDisplay::print_centered_title(" ", 1);
+                  TFTDisplay::wait_idle();
                   run = false;
                   system("poweroff");
                 }
@@ -594,7 +687,7 @@ int main() {
             if(run){
               std::vector<std::string> sbv(conf_menus.begin() + cnt,
                   conf_menus.begin() + cnt + TFTDisplay::max_conf_menus);
-              TFTDisplay::print_conf_menu(true, true, sbv, top_border_conf_menu, -1);
+              TFTDisplay::print_conf_menu(true, sbv, top_border_conf_menu);
             }
           }
           else if(data.symbol == Buttons::LEFT){
@@ -607,13 +700,13 @@ int main() {
                   cnt++;
                   std::vector<std::string> sbv(conf_menus.begin() + cnt,
                       conf_menus.begin() + cnt + TFTDisplay::max_conf_menus);
-                  TFTDisplay::print_conf_menu(false, true, sbv, top_border_conf_menu, -1);
+                  TFTDisplay::print_conf_menu(false, sbv, top_border_conf_menu);
                 }
               }
               else{
                 std::vector<std::string> sbv(conf_menus.begin() + cnt,
                     conf_menus.begin() + cnt + TFTDisplay::max_conf_menus);
-                TFTDisplay::print_conf_menu(false, false, sbv, top_border_conf_menu + 1, top_border_conf_menu);
+                TFTDisplay::print_conf_menu(false, sbv, top_border_conf_menu + 1);
                 bottom_border_conf_menu--;
                 top_border_conf_menu++;
               }
@@ -627,13 +720,13 @@ int main() {
                   cnt--;
                   std::vector<std::string> sbv(conf_menus.begin() + cnt,
                       conf_menus.begin() + cnt + TFTDisplay::max_conf_menus);
-                  TFTDisplay::print_conf_menu(false, true, sbv, top_border_conf_menu, -1);
+                  TFTDisplay::print_conf_menu(false, sbv, top_border_conf_menu);
                 }
               }
               else{
                 std::vector<std::string> sbv(conf_menus.begin() + cnt,
                     conf_menus.begin() + cnt + TFTDisplay::max_conf_menus);
-                TFTDisplay::print_conf_menu(false, false, sbv, top_border_conf_menu - 1, top_border_conf_menu);
+                TFTDisplay::print_conf_menu(false, sbv, top_border_conf_menu - 1);
                 bottom_border_conf_menu++;
                 top_border_conf_menu--;
               }
@@ -645,6 +738,8 @@ int main() {
       }
     }
   }
+  //The tracker thread rotates the Display, so it must stop before the Display is closed
+  orientation_tracker.reset();
   TFTDisplay::end();
   Buttons::buttons_thread_finisher();
   MQTT::client_mqtt_thread_finisher();
@@ -734,10 +829,11 @@ std::vector<std::string> get_time_zone_list_and_index(std::string timezone_file_
   * @param[in] right_fn Function to be executed when a right pulse is detected and when the timeout is true.
   * @param[in] left_fn Function to be executed when a left pulse is detected.
   * @param[in] down_fn Function to be executed when a down pulse is detected.
+  * @param[in] up_fn Function to be executed when an up pulse is detected.
   * @param[in] timeout If true, right_fn will be executed.
   */
 void main_menu_handler(std::function<void()> right_fn, std::function<void()> left_fn,
-    std::function<void()> down_fn, bool timeout){
+    std::function<void()> down_fn, std::function<void()> up_fn, bool timeout){
   Buttons::BUTTON data;
 
   if(Buttons::buttonsQueue.size() != 0){
@@ -749,6 +845,8 @@ void main_menu_handler(std::function<void()> right_fn, std::function<void()> lef
         left_fn();
       else if(data.symbol == Buttons::DOWN)
         down_fn();
+      else if(data.symbol == Buttons::UP)
+        up_fn();
     }
   }
   if(timeout)
@@ -786,10 +884,11 @@ std::string editable_text_menu(std::string title, std::string text, uint32_t lon
 
   TFTDisplay::print_centered_title(title, 2);
   std::this_thread::sleep_for(std::chrono::seconds(1));
-  TFTDisplay::print_editable_text(true, true, text, leftmost_border_menu, -1);
+  TFTDisplay::print_editable_text(true, text, leftmost_border_menu);
 
   while(true){
-    pulsed = Buttons::buttonsQueue.pop();
+    if(!wait_pulse(&pulsed))
+      return text;
 
     //Quit time zone selection
     if(pulsed.symbol == Buttons::CENTER){
@@ -800,13 +899,11 @@ std::string editable_text_menu(std::string title, std::string text, uint32_t lon
         [&] () {
           int step = right_left_fn(&text, init_visible_str + leftmost_border_menu, true) -
               (init_visible_str + leftmost_border_menu);
-          bool text_refresh = false;
 
           for(int i = 0; i < step; i++){
             if(rightmost_border_menu == 0){
               if(init_visible_str < int(text.size() - 1 - leftmost_border_menu)){
                 init_visible_str++;
-                text_refresh = true;
               }
             }
             else{
@@ -817,13 +914,7 @@ std::string editable_text_menu(std::string title, std::string text, uint32_t lon
 
           std::string sub_str = text.substr(init_visible_str, TFTDisplay::max_chars_edit_menu);
 
-          if(text_refresh){
-            TFTDisplay::print_editable_text(false, true, sub_str, leftmost_border_menu, -1);
-          }
-          else{
-            TFTDisplay::print_editable_text(
-                false, false, sub_str, leftmost_border_menu, leftmost_border_menu - step);
-          }
+          TFTDisplay::print_editable_text(false, sub_str, leftmost_border_menu);
         }
       );
     }
@@ -832,13 +923,11 @@ std::string editable_text_menu(std::string title, std::string text, uint32_t lon
         [&] () {
           int step = (init_visible_str + leftmost_border_menu) -
               right_left_fn(&text, init_visible_str + leftmost_border_menu, false);
-          bool text_refresh = false;
 
           for(int i = 0; i < step; i++){
             if(leftmost_border_menu == 0){
               if(init_visible_str > 0){
                 init_visible_str--;
-                text_refresh = true;
               }
             }
             else{
@@ -849,13 +938,7 @@ std::string editable_text_menu(std::string title, std::string text, uint32_t lon
 
           std::string sub_str = text.substr(init_visible_str, TFTDisplay::max_chars_edit_menu);
 
-          if(text_refresh){
-            TFTDisplay::print_editable_text(false, true, sub_str, leftmost_border_menu, -1);
-          }
-          else{
-            TFTDisplay::print_editable_text(
-                false, false, sub_str, leftmost_border_menu, leftmost_border_menu + step);
-          }
+          TFTDisplay::print_editable_text(false, sub_str, leftmost_border_menu);
         }
       );
     }
@@ -864,7 +947,7 @@ std::string editable_text_menu(std::string title, std::string text, uint32_t lon
         [&] () {
           text = up_down_fn(text, init_visible_str + leftmost_border_menu, true);
           std::string sub_str = text.substr(init_visible_str, TFTDisplay::max_chars_edit_menu);
-          TFTDisplay::print_editable_text(false, true, sub_str, leftmost_border_menu, -1);
+          TFTDisplay::print_editable_text(false, sub_str, leftmost_border_menu);
         }
       );
     }
@@ -873,7 +956,7 @@ std::string editable_text_menu(std::string title, std::string text, uint32_t lon
         [&] () {
           text = up_down_fn(text, init_visible_str + leftmost_border_menu, false);
           std::string sub_str = text.substr(init_visible_str, TFTDisplay::max_chars_edit_menu);
-          TFTDisplay::print_editable_text(false, true, sub_str, leftmost_border_menu, -1);
+          TFTDisplay::print_editable_text(false, sub_str, leftmost_border_menu);
         }
       );
     }
@@ -914,10 +997,10 @@ int text_list_menu(std::string title, std::vector<std::string> list, uint32_t lo
   std::this_thread::sleep_for(std::chrono::seconds(1));
   TFTDisplay::print_text_list(true, true, sublist, [] (){return 0;});
 
-  while(true){
-    if(Buttons::buttonsQueue.size() != 0){
+  while(run){
+    sleep_if_idle();
 
-      pulsed = Buttons::buttonsQueue.pop();
+    if(Buttons::buttonsQueue.pop(&pulsed, 0)){
 
       //Quit time zone selection
       if(pulsed.symbol == Buttons::CENTER){
@@ -963,6 +1046,7 @@ int text_list_menu(std::string title, std::vector<std::string> list, uint32_t lo
         std::this_thread::sleep_for(std::chrono::milliseconds(100));
       }
       TFTDisplay::print_text_list(false, false, sublist, exit_fn);
+      TFTDisplay::wait_idle();  //Panning ends by itself or when a button is pressed
       if(Buttons::buttonsQueue.size() == 0){
         cnt = 0;
         while(cnt++ < 10 && Buttons::buttonsQueue.size() == 0){
@@ -988,8 +1072,8 @@ int text_list_menu(std::string title, std::vector<std::string> list, uint32_t lo
   * @brief Prints a yes/no window and returns the selected option by the user.
   *
   * @param[in] title The text represented as the title of the yes/no window.
-  * @param[in] size The text size. Can be 1 (small), 2 (medium) or 3 (big). Greater values will
-  *                 be truncated to 3.
+  * @param[in] size The text size. Can be 1 (small) or 2 (big). Greater values will be truncated
+  *                 to 2.
   *
   * @return True if the user has accepted the message or false if not.
   */
@@ -997,8 +1081,7 @@ bool yes_no_choice_menu(std::string title, int size){
   TFTDisplay::print_selection_text(title, size);
   Buttons::BUTTON data;
 
-  for(;;){
-    data = Buttons::buttonsQueue.pop();
+  while(wait_pulse(&data)){
     if(data.type == Buttons::SHORT_PULSE){
       if(data.symbol == Buttons::RIGHT){
         return false;
@@ -1067,11 +1150,43 @@ void pulse_action(Buttons::BUTTON previous_pulsed, uint32_t us_cycle, std::funct
     do{
       action();
       usleep(us_cycle);
-      if(Buttons::buttonsQueue.size() > 0){
-        aux_pulsed = Buttons::buttonsQueue.pop();
+      if(Buttons::buttonsQueue.pop(&aux_pulsed, 0)){
         pressed = aux_pulsed.symbol != previous_pulsed.symbol ||
                   aux_pulsed.type != Buttons::LONG_PULSE_RELEASED;
       }
-    }while(pressed);
+    }while(pressed && run);
 }
 
+
+/**
+ * @brief Turns the Display off if no button has been pulsed for "idle_timeout_ms" and keeps it off until a button
+ *        is pulsed. That pulse only turns it on again, showing the same screen. It returns instantly if the
+ *        Display doesn't have to be turned off.
+ */
+void sleep_if_idle(){
+  Buttons::BUTTON data;
+
+  if(idle_timeout_ms <= 0 || Buttons::get_idle_time_ms() < idle_timeout_ms)
+    return;
+
+  TFTDisplay::sleep();
+  while(run && !Buttons::buttonsQueue.pop(&data, idle_poll_ms));
+  TFTDisplay::wake();
+}
+
+
+/**
+ * @brief Waits for a button pulse, turning the Display off meanwhile if the idle timeout passes.
+ *
+ * @param[out] data The pulse.
+ *
+ * @return True if a pulse has been obtained, false if the program has finished before.
+ */
+bool wait_pulse(Buttons::BUTTON *data){
+  while(run){
+    sleep_if_idle();
+    if(Buttons::buttonsQueue.pop(data, idle_poll_ms))
+      return true;
+  }
+  return false;
+}
@@ -39,6 +39,11 @@
 
 #define LEN_DATA_FIELD_0                  17
 
+#define FIRST_POLL_BACKOFF_US   500   //Wait before the second status poll. It doubles after every poll
+#define MAX_POLL_BACKOFF_US     8000
+#define MAX_POLLS               6     //At most 15.5 ms (0.5 + 1 + 2 + 4 + 8) of polling after the expected end
+                                      //of the conversion
+
 #define RESET_VALUE         0xB6
 #define CHIP_ID_VALUE       0x61
 #define VARIANT_ID_VALUE    0x01
@@ -47,6 +52,8 @@
 #define OVSP_MASK           0x07
 #define NB_CONV_MASK        0x0F
 #define NEW_DATA_MSK        0x80
+#define GAS_MEASURING_MSK   0x40
+#define MEASURING_MSK       0x20
 #define GAS_RANGE_MSK       0x0F
 
 #define SLEEP_OP_MODE         0
@@ -106,6 +113,7 @@ static int get_data_forced_mode(float *temperature, float *pressure, float *humi
                                 float temp_offset, bme688_calib_sensor *calibs);
 static int set_operation_mode(uint8_t mode);
 static uint32_t get_measure_duration(uint8_t mode, bme688_oversamplings ovsp);
+static uint32_t get_gas_wait_us(uint8_t gas_wait_x);
 static int get_calibs(bme688_calib_sensor *calibs);
 static int set_heat_gas_confs(uint8_t mode, float target_temp, float amb_temp, uint16_t ms, bme688_calib_gas_sensor gas_cals);
 static uint8_t calc_res_heat_x(float target_temp, float amb_temp, bme688_calib_gas_sensor gas_cals);
@@ -217,12 +225,15 @@ int BME688::set_heater_configurations(bool run_gas, float target_temp, uint16_t
 
   if(I2C_Master::write_msg(BME688_ADRR, buffer, 4) == -1)
     return -1;
+
+  heater_us = run_gas ? get_gas_wait_us(calc_gas_wait_x(ms)) : 0;
   return 0;
 }
 
 
 /**
-  * @brief Obtain a measure from all the metris of the BME sensor. If a specific metric is not needed, pass NULL as parameter.
+  * @brief Obtain a measure from all the metris of the BME sensor. It blocks until the measure has finished. If a specific
+  *        metric is not needed, pass NULL as parameter.
   *
   * @param[out] temperature The temperature obtained from the sensor.
   * @param[out] pressure The pressure obtained from the sensor.
@@ -233,10 +244,49 @@ int BME688::set_heater_configurations(bool run_gas, float target_temp, uint16_t
   * @return 0 if success, -1 if error.
   */
 int BME688::get_data_one_measure(float *temperature, float *pressure, float *humidity, float *gas_resistance){
-  set_operation_mode(FORCED_OP_MODE);
+  uint32_t duration_us;
+
+  if(start_measure(&duration_us) == -1)
+    return -1;
+
+  usleep(duration_us);
+
+  return read_measure(temperature, pressure, humidity, gas_resistance);
+}
+
+
+/**
+  * @brief Starts one measure of all the metrics in forced mode. It returns instantly.
+  *
+  * @param[out] duration_us The expected time in microseconds until the measure is finished, heating of the gas sensor
+  *                         included.
+  *
+  * @return 0 if success, -1 if error.
+  */
+int BME688::start_measure(uint32_t *duration_us){
+  if(set_operation_mode(FORCED_OP_MODE) == -1)
+    return -1;
+
+  *duration_us = get_measure_duration(FORCED_OP_MODE, ovsp) + heater_us;
+  return 0;
+}
 
-  usleep(get_measure_duration(FORCED_OP_MODE, ovsp) + 100000);
 
+/**
+  * @brief Obtain the result of the measure started with start_measure. It should be called once the time given
+  *        by start_measure has elapsed. If the sensor is still measuring, it polls the status of the sensor with
+  *        an increasing wait between polls, for a few milliseconds at most. If a specific metric is not needed,
+  *        pass NULL as parameter.
+  *
+  * @param[out] temperature The temperature obtained from the sensor.
+  * @param[out] pressure The pressure obtained from the sensor.
+  * @param[out] humidity The humidity obtained from the sensor.
+  * @param[out] gas_resistance The gas resistance of the hot plate obtained from the sensor. Greater values indicates good
+  *                            quality air, smaller values indicates bad quality air.
+  *
+  * @return 0 if success, -1 if error or if the measure didn't finish in time.
+  */
+int BME688::read_measure(float *temperature, float *pressure, float *humidity, float *gas_resistance){
   return get_data_forced_mode(temperature, pressure, humidity, gas_resistance, temp_offset, &calibs);
 }
 
@@ -279,7 +329,7 @@ static int set_operation_mode(uint8_t mode){
   * @param[in] mode The operation mode. Can be SLEEP_OP_MODE, FORCED_OP_MODE or PARALLEL_OP_MODE.
   * @param[in] ovsp A structure with the oversamplings for temperature, pressure and humidity.
   *
-  * @return 0 if success, -1 if error.
+  * @return The duration of the measure in microseconds, without the heating of the gas sensor.
   */
 static uint32_t get_measure_duration(uint8_t mode, bme688_oversamplings ovsp){
   uint8_t meas_cycles = 0;
@@ -302,8 +352,9 @@ static uint32_t get_measure_duration(uint8_t mode, bme688_oversamplings ovsp){
 
 
 /**
-  * @brief Obtain a measure from all the metrics of the BME sensor in the forced mode. If a specific metric is not needed,
-  * pass NULL as parameter.
+  * @brief Obtain a measure from all the metrics of the BME sensor in the forced mode. The status of the sensor is polled
+  * until the measure has finished, waiting a bit longer after each poll. If a specific metric is not needed, pass NULL as
+  * parameter.
   *
   * @param[out] temperature The temperature obtained from the sensor.
   * @param[out] pressure The pressure obtained from the sensor.
@@ -325,9 +376,20 @@ static int get_data_forced_mode(float *temperature, float *pressure, float *humi
   uint32_t adc_pres;
   uint16_t adc_hum;
   uint16_t adc_gas_res;
-  uint8_t tries = 5;
+  uint32_t backoff_us = FIRST_POLL_BACKOFF_US;
+
+  for(int poll = 0; poll < MAX_POLLS; poll++){
+    if(poll > 0){
+      usleep(backoff_us);
+      backoff_us = backoff_us * 2 > MAX_POLL_BACKOFF_US ? MAX_POLL_BACKOFF_US : backoff_us * 2;
+    }
+
+    //The status byte is enough to know if the measure has finished
+    if(I2C_Master::read_msg(BME688_ADRR, START_DATA_FIELD_0_REG, buffer, 1) == -1)
+      continue;
+    if(!(buffer[0] & NEW_DATA_MSK) || (buffer[0] & (MEASURING_MSK | GAS_MEASURING_MSK)))
+      continue;
 
-  do{
     if(I2C_Master::read_msg(BME688_ADRR, START_DATA_FIELD_0_REG, buffer, LEN_DATA_FIELD_0) != -1){
       if(buffer[0] & NEW_DATA_MSK){
 
@@ -353,8 +415,7 @@ static int get_data_forced_mode(float *temperature, float *pressure, float *humi
         return 0;
       }
     }
-    tries--;
-  }while(tries);
+  }
 
   return -1;
 }
@@ -487,6 +548,23 @@ static uint8_t calc_gas_wait_x(uint16_t ms){
 }
 
 
+/**
+  * @brief Calculate the heating time of the gas sensor from the value written in its register, which can be shorter
+  * than the requested one because of the format specified in the datasheet.
+  *
+  * @param[in] gas_wait_x The value of the gas_wait_x register.
+  *
+  * @return the time in microseconds.
+  */
+static uint32_t get_gas_wait_us(uint8_t gas_wait_x){
+  uint32_t ms = gas_wait_x & 0x3F;
+
+  for(uint8_t mult_factor = gas_wait_x >> 6; mult_factor > 0; mult_factor--)
+    ms *= 4;
+  return ms * 1000;
+}
+
+
 /**
   * @brief Calculate the compensated temperature.
   *
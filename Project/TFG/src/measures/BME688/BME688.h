@@ -91,12 +91,13 @@ class BME688{
   bme688_oversamplings ovsp;
   float amb_temp;
   float temp_offset;
+  uint32_t heater_us;
 public:
 
   /**
     * @brief Class constructor. Sets the ambient temperature.
     */
-  BME688(float amb_temp, float temp_offset): amb_temp(amb_temp), temp_offset(temp_offset){};
+  BME688(float amb_temp, float temp_offset): amb_temp(amb_temp), temp_offset(temp_offset), heater_us(0){};
 
   /**
     * @brief Starts the module and the communications with the BME sensor and obtain the calibration parameters from the sensor.
@@ -137,7 +138,8 @@ public:
   int set_heater_configurations(bool run_gas, float target_temp, uint16_t ms);
 
   /**
-    * @brief Obtain a measure from all the metris of the BME sensor. If a specific metric is not needed, pass NULL as parameter.
+    * @brief Obtain a measure from all the metris of the BME sensor. It blocks until the measure has finished. If a specific
+    *        metric is not needed, pass NULL as parameter.
     *
     * @param[out] temperature The temperature obtained from the sensor.
     * @param[out] pressure The pressure obtained from the sensor.
@@ -149,6 +151,32 @@ public:
     */
   int get_data_one_measure(float *temperature, float *pressure, float *humidity, float *gas_resistance);
 
+  /**
+    * @brief Starts one measure of all the metrics in forced mode. It returns instantly.
+    *
+    * @param[out] duration_us The expected time in microseconds until the measure is finished, heating of the gas sensor
+    *                         included.
+    *
+    * @return 0 if success, -1 if error.
+    */
+  int start_measure(uint32_t *duration_us);
+
+  /**
+    * @brief Obtain the result of the measure started with start_measure. It should be called once the time given
+    *        by start_measure has elapsed. If the sensor is still measuring, it polls the status of the sensor with
+    *        an increasing wait between polls, for a few milliseconds at most. If a specific metric is not needed,
+    *        pass NULL as parameter.
+    *
+    * @param[out] temperature The temperature obtained from the sensor.
+    * @param[out] pressure The pressure obtained from the sensor.
+    * @param[out] humidity The humidity obtained from the sensor.
+    * @param[out] gas_resistance The gas resistance of the hot plate obtained from the sensor. Greater values indicates good
+    *                            quality air, smaller values indicates bad quality air.
+    *
+    * @return 0 if success, -1 if error or if the measure didn't finish in time.
+    */
+  int read_measure(float *temperature, float *pressure, float *humidity, float *gas_resistance);
+
   /**
    * @brief End communications with the sensor and free all the related resources.
    */
@@ -0,0 +1,88 @@
+/**
+  ******************************************************************************
+  * @file   MeasureHistory.cpp
+  * @author Pablo San Millán Fierro (pablo.sanmillanf@alumnos.upm.es)
+  * @brief  Measure history Module.
+  *
+  * @note   End-of-degree work.
+  *         This module keeps the recent history of a measure in memory. The
+  *         measures received during each period are averaged into one sample
+  *         and the last samples are kept in a circular buffer.
+  ******************************************************************************
+*/
+
+/* Includes ------------------------------------------------------------------*/
+#include "MeasureHistory.h" // Module header
+#include <algorithm>
+
+/* Private defines -----------------------------------------------------------*/
+/* Private typedef -----------------------------------------------------------*/
+/* Private variables----------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+/* Functions -----------------------------------------------------------------*/
+
+/**
+ * @brief Class constructor. The history starts empty.
+ *
+ * @param[in] capacity The number of samples kept.
+ * @param[in] period_s The time in seconds averaged in each sample.
+ */
+MeasureHistory::MeasureHistory(int capacity, uint32_t period_s):
+    samples(capacity), stored_samples(0), period(period_s), period_start(std::chrono::steady_clock::now()),
+    period_sum(0), period_count(0){
+}
+
+
+/**
+ * @brief Adds a measure to the current period. When the period has elapsed, the mean of its measures is
+ *        stored as a new sample, replacing the oldest one if the history is full.
+ *
+ * @param[in] value The measure.
+ */
+void MeasureHistory::add(float value){
+  std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+  std::lock_guard<std::mutex> lock(mutex);
+
+  period_sum += value;
+  period_count++;
+
+  if(now - period_start < period)
+    return;
+
+  samples[stored_samples % samples.size()] = period_sum / period_count;
+  stored_samples++;
+  period_start = now;
+  period_sum = 0;
+  period_count = 0;
+}
+
+
+/**
+ * @brief Obtain the stored samples.
+ *
+ * @param[out] samples Where the samples are copied, from the oldest to the newest. Its previous contents
+ *                     are replaced.
+ *
+ * @return The number of samples stored since the start. It only grows, so comparing it with a previous value
+ *         gives the number of samples added since then.
+ */
+long MeasureHistory::get_samples(std::vector<float> *samples){
+  std::lock_guard<std::mutex> lock(mutex);
+  long capacity = this->samples.size();
+
+  samples->clear();
+  for(long i = std::max(0L, stored_samples - capacity); i < stored_samples; i++)
+    samples->push_back(this->samples[i % capacity]);
+
+  return stored_samples;
+}
+
+
+/**
+ * @brief Obtain the time averaged in each sample.
+ *
+ * @return The time in seconds.
+ */
+uint32_t MeasureHistory::get_period_s(){
+  return period.count();
+}
@@ -0,0 +1,75 @@
+/**
+  ******************************************************************************
+  * @file   MeasureHistory.h
+  * @author Pablo San Millán Fierro (pablo.sanmillanf@alumnos.upm.es)
+  * @brief  Measure history Module Header.
+  *
+  * @note   End-of-degree work.
+  *         This module keeps the recent history of a measure in memory. The
+  *         measures received during each period are averaged into one sample
+  *         and the last samples are kept in a circular buffer.
+  ******************************************************************************
+*/
+
+#ifndef __MEASUREHISTORY_H__
+#define __MEASUREHISTORY_H__
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <chrono>
+#include <mutex>
+#include <vector>
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported types ------------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported Functions --------------------------------------------------------*/
+
+class MeasureHistory{
+  std::mutex mutex;
+  std::vector<float> samples;   //Circular buffer with the averaged samples
+  long stored_samples;          //Number of samples stored since the start. The next one goes to
+                                //samples[stored_samples % samples.size()]
+  std::chrono::seconds period;
+  std::chrono::steady_clock::time_point period_start;
+  float period_sum;
+  int period_count;
+public:
+
+  /**
+   * @brief Class constructor. The history starts empty.
+   *
+   * @param[in] capacity The number of samples kept.
+   * @param[in] period_s The time in seconds averaged in each sample.
+   */
+  MeasureHistory(int capacity, uint32_t period_s);
+
+  /**
+   * @brief Adds a measure to the current period. When the period has elapsed, the mean of its measures is
+   *        stored as a new sample, replacing the oldest one if the history is full.
+   *
+   * @param[in] value The measure.
+   */
+  void add(float value);
+
+  /**
+   * @brief Obtain the stored samples.
+   *
+   * @param[out] samples Where the samples are copied, from the oldest to the newest. Its previous contents
+   *                     are replaced.
+   *
+   * @return The number of samples stored since the start. It only grows, so comparing it with a previous value
+   *         gives the number of samples added since then.
+   */
+  long get_samples(std::vector<float> *samples);
+
+  /**
+   * @brief Obtain the time averaged in each sample.
+   *
+   * @return The time in seconds.
+   */
+  uint32_t get_period_s();
+};
+
+#endif /* __MEASUREHISTORY_H__ */
@@ -0,0 +1,143 @@
+/**
+  ******************************************************************************
+  * @file   OrientationTracker.cpp
+  * @author Pablo San Millán Fierro (pablo.sanmillanf@alumnos.upm.es)
+  * @brief  Device orientation tracker Module.
+  *
+  * @note   End-of-degree work.
+  *         This module reads the gravity direction from the LSM6DSOX
+  *         accelerometer and reports how many clockwise quarter turns the
+  *         contents of the panel must be rotated to be seen upright.
+  ******************************************************************************
+*/
+
+/* Includes ------------------------------------------------------------------*/
+#include "OrientationTracker.h" // Module header
+#include <unistd.h>
+#include <cmath>
+
+/* Private defines -----------------------------------------------------------*/
+#define MIN_PLANE_GRAVITY  0.5f     //In g. Below it the device is too flat to know its orientation
+#define MAX_AXIS_RATIO     0.577f   //tan(30º). Readings further than 30º from an axis are ambiguous
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private variables----------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+/* Functions -----------------------------------------------------------------*/
+
+/**
+ * @brief Class constructor. Starts the accelerometer. The sensor is expected to have its X axis pointing to the
+ *        right of the panel and its Y axis pointing to the top of the panel.
+ *
+ * @param[in] mounting_quarter_turns Clockwise quarter turns between the axes of the sensor and the expected ones.
+ * @param[in] period_us The time in microseconds between two readings of the accelerometer.
+ * @param[in] stable_samples The number of consecutive readings that must agree before the orientation changes.
+ * @param[in] on_change Function called from the tracker thread with the new number of clockwise quarter turns
+ *                      (0 to 3) each time the orientation changes.
+ */
+OrientationTracker::OrientationTracker(int mounting_quarter_turns, uint32_t period_us, int stable_samples,
+    std::function<void (int quarter_turns)> on_change):
+    sensor(LSM6DSOX_26_HZ_ODR, LSM6DSOX_OFF_ODR), mounting_quarter_turns(((mounting_quarter_turns % 4) + 4) % 4),
+    period_us(period_us), stable_samples(stable_samples), on_change(on_change), orientation(0), run(false){
+}
+
+
+/**
+ * @brief Starts reading the accelerometer in a different thread. It returns instantly.
+ */
+void OrientationTracker::start(){
+  if(!run){
+    run = true;
+    tracker_thread = std::thread(thread, this);
+  }
+}
+
+
+/**
+ * @brief Obtain the last stable orientation.
+ *
+ * @return The number of clockwise quarter turns (0 to 3) that the contents of the panel must be rotated.
+ */
+int OrientationTracker::get_orientation(){
+  return orientation;
+}
+
+
+/**
+ * @brief Class destructor. Stops the tracker thread.
+ */
+OrientationTracker::~OrientationTracker(){
+  run = false;
+  if(tracker_thread.joinable())
+    tracker_thread.join();
+}
+
+
+
+/* Private functions ---------------------------------------------------------*/
+/**
+ * @brief Obtains the orientation from one reading of the accelerometer. At rest, the accelerometer measures
+ *        +1g in the axis that points upwards.
+ *
+ * @param[in] x The acceleration in the X axis, in g.
+ * @param[in] y The acceleration in the Y axis, in g.
+ * @param[in] z The acceleration in the Z axis, in g.
+ *
+ * @return The number of clockwise quarter turns (0 to 3), or -1 if the reading doesn't show a clear orientation.
+ */
+int OrientationTracker::classify(float x, float y, float z){
+  float abs_x = std::fabs(x);
+  float abs_y = std::fabs(y);
+  int quarter_turns;
+
+  if(std::hypot(x, y) < MIN_PLANE_GRAVITY)
+    return -1;
+
+  if(abs_y > abs_x){
+    if(abs_x > abs_y * MAX_AXIS_RATIO)
+      return -1;
+    quarter_turns = y > 0 ? 0 : 2;    //Top or bottom edge upwards
+  }
+  else{
+    if(abs_y > abs_x * MAX_AXIS_RATIO)
+      return -1;
+    quarter_turns = x > 0 ? 1 : 3;    //Right or left edge upwards
+  }
+
+  return (quarter_turns + mounting_quarter_turns) % 4;
+}
+
+
+/**
+ * @brief Reads the accelerometer periodically and reports the orientation when it has been the same for
+ *        "stable_samples" readings.
+ *
+ * @param[in] tracker The tracker.
+ */
+void OrientationTracker::thread(OrientationTracker *tracker){
+  float x, y, z;
+  int candidate = -1;
+  int candidate_samples = 0;
+  bool reported = false;
+
+  while(tracker->run){
+    int current = -1;
+
+    if(tracker->sensor.get_acc_values(&x, &y, &z) != -1)
+      current = tracker->classify(x, y, z);
+
+    if(current == -1 || current != candidate){
+      candidate = current;
+      candidate_samples = 0;
+    }
+
+    if(candidate != -1 && ++candidate_samples >= tracker->stable_samples &&
+        (!reported || candidate != tracker->orientation)){
+      tracker->orientation = candidate;
+      reported = true;
+      tracker->on_change(candidate);
+    }
+
+    usleep(tracker->period_us);
+  }
+}
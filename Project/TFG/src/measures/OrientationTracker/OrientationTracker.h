@@ -0,0 +1,75 @@
+/**
+  ******************************************************************************
+  * @file   OrientationTracker.h
+  * @author Pablo San Millán Fierro (pablo.sanmillanf@alumnos.upm.es)
+  * @brief  Device orientation tracker Module Header.
+  *
+  * @note   End-of-degree work.
+  *         This module reads the gravity direction from the LSM6DSOX
+  *         accelerometer and reports how many clockwise quarter turns the
+  *         contents of the panel must be rotated to be seen upright.
+  ******************************************************************************
+*/
+
+#ifndef __ORIENTATIONTRACKER_H__
+#define __ORIENTATIONTRACKER_H__
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdint.h>
+#include <atomic>
+#include <thread>
+#include <functional>
+#include "../LSM6DSOX/LSM6DSOX.h"
+
+/* Exported variables --------------------------------------------------------*/
+/* Exported types ------------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported Functions --------------------------------------------------------*/
+
+class OrientationTracker{
+  LSM6DSOX sensor;
+  int mounting_quarter_turns;
+  uint32_t period_us;
+  int stable_samples;
+  std::function<void (int quarter_turns)> on_change;
+  std::atomic<int> orientation;
+  std::atomic<bool> run;
+  std::thread tracker_thread;
+
+  int classify(float x, float y, float z);
+  static void thread(OrientationTracker *tracker);
+public:
+
+  /**
+   * @brief Class constructor. Starts the accelerometer. The sensor is expected to have its X axis pointing to the
+   *        right of the panel and its Y axis pointing to the top of the panel.
+   *
+   * @param[in] mounting_quarter_turns Clockwise quarter turns between the axes of the sensor and the expected ones.
+   * @param[in] period_us The time in microseconds between two readings of the accelerometer.
+   * @param[in] stable_samples The number of consecutive readings that must agree before the orientation changes.
+   * @param[in] on_change Function called from the tracker thread with the new number of clockwise quarter turns
+   *                      (0 to 3) each time the orientation changes.
+   */
+  OrientationTracker(int mounting_quarter_turns, uint32_t period_us, int stable_samples,
+      std::function<void (int quarter_turns)> on_change);
+
+  /**
+   * @brief Starts reading the accelerometer in a different thread. It returns instantly.
+   */
+  void start();
+
+  /**
+   * @brief Obtain the last stable orientation.
+   *
+   * @return The number of clockwise quarter turns (0 to 3) that the contents of the panel must be rotated.
+   */
+  int get_orientation();
+
+  /**
+   * @brief Class destructor. Stops the tracker thread.
+   */
+  ~OrientationTracker();
+};
+
+#endif /* __ORIENTATIONTRACKER_H__ */
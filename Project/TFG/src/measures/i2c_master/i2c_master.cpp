@@ -21,6 +21,7 @@
 /* Private typedef -----------------------------------------------------------*/
 /* Private variables----------------------------------------------------------*/
 static int fd;
+static int users;     //Number of start calls without their end call. The device is closed by the last end call
 static struct i2c_rdwr_ioctl_data packets;
 static struct i2c_msg messages[2];
 static std::mutex mutex;
@@ -37,6 +38,8 @@ static std::mutex mutex;
  * @return 0 if success, -1 if error.
  */
 int I2C_Master::start (int i2c_device) {
+  std::lock_guard<std::mutex> lock(mutex);
+
   if(fd == 0){
     //Open file descriptor
     char i2cFile[15];
@@ -45,10 +48,12 @@ int I2C_Master::start (int i2c_device) {
     fd = open(i2cFile, O_RDWR);
     
     if(fd == -1){
+      fd = 0;
       return -1;
     }
   }
-  
+
+  users++;
   return 0;
 }
 
@@ -130,11 +135,17 @@ int I2C_Master::read_msg(uint8_t addr, uint8_t read_reg, uint8_t data[], uint8_t
 
 
 /**
- * @brief End I2C communications and free all the related resources.
+ * @brief End I2C communications and free all the related resources. The I2C device is shared by all the
+ *        modules that have called start, so it is only closed when all of them have called end.
  * 
  * @return 0 if success, -1 if error.
  */
 int I2C_Master::end(){
+  std::lock_guard<std::mutex> lock(mutex);
+
+  if(users == 0 || --users > 0)
+    return 0;
+
   int status = close(fd);
   if(status != -1){
     fd = 0;
@@ -64,7 +64,8 @@ extern "C" {
       int read_msg(uint8_t addr, uint8_t read_reg, uint8_t data[], uint8_t data_length);
       
       /**
-       * @brief End I2C communications and free all the related resources.
+       * @brief End I2C communications and free all the related resources. The I2C device is shared by all the
+       *        modules that have called start, so it is only closed when all of them have called end.
        * 
        * @return 0 if success, -1 if error.
        */
@@ -15,14 +15,31 @@
 #include <unistd.h>
 #include <cmath>
 #include <syslog.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <sys/timerfd.h>
 
 /* External variables---------------------------------------------------------*/
 Measures::BME_DATA Measures::bme_data = {-1, -1, -1, -1, -1};
+Measures::BME_HISTORY Measures::bme_history = {
+    {history_samples, history_period_s},
+    {history_samples, history_period_s},
+    {history_samples, history_period_s},
+    {history_samples, history_period_s},
+    {history_samples, history_period_s}
+};
 /* Private defines -----------------------------------------------------------*/
 /* Private typedef -----------------------------------------------------------*/
 /* Private variables----------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
+static void publish_measure(IAQTracker *tracker, float temperature, float pressure, float humidity,
+    float gas_resistance);
 static float obtain_sea_level_altitude(float pressure);
+static void add_time_us(struct timespec *time, uint32_t us);
+static bool is_before(const struct timespec *a, const struct timespec *b);
+static void wait_until(int timer_fd, const struct timespec *deadline);
 /* Functions -----------------------------------------------------------------*/
 
 /**
@@ -33,11 +50,11 @@ static float obtain_sea_level_altitude(float pressure);
  * @param[in] ovsp_hum The humidity oversampling. Must be OVSP_0_X, OVSP_1_X, OVSP_2_X, OVSP_4_X, OVSP_8_X or OVSP_16_X.
  * @param[in] target_gas_temp  The temperature that the hot plate of the gas sensor will reach to get the measure.
  * @param[in] gas_ms  The time to obtain the desired temperature in the hot plate of the gas sensor. Should be greater than 30ms.
- * @param[in] measure_rate_us The time in microseconds between the end of one measure and the start of the next.
+ * @param[in] measure_period_us The time in microseconds between the starts of two consecutive measures.
  *
  */
 void Measures::Meas::init(uint8_t ovsp_temp, uint8_t ovsp_press, uint8_t ovsp_hum,
-    float target_gas_temp, uint16_t gas_ms, uint32_t measure_rate_us){
+    float target_gas_temp, uint16_t gas_ms, uint32_t measure_period_us){
 
   gas_on = true;
   temp_on = true;
@@ -48,7 +65,7 @@ void Measures::Meas::init(uint8_t ovsp_temp, uint8_t ovsp_press, uint8_t ovsp_hu
   this->ovsp_hum = ovsp_hum;
   this->target_gas_temp = target_gas_temp;
   this->gas_ms = gas_ms;
-  this->measure_rate_us = measure_rate_us;
+  this->measure_period_us = measure_period_us;
 
   sensor.init();
   sensor.set_oversamplings(ovsp_temp, ovsp_press, ovsp_hum);
@@ -150,32 +167,47 @@ void Measures::Meas::change_oversamplings(){
 }
 
 
+/**
+ * @brief Takes one measure every "measure_period_us". The measures start on a fixed schedule of the monotonic clock,
+ *        so the period doesn't drift with the time spent measuring. After starting a measure, the thread sleeps until
+ *        the time the sensor needs to finish it and reads the result right away. If a measure takes longer than the
+ *        period, the starts that were missed are skipped.
+ *
+ * @param[in] meas The measures handler.
+ */
 void Measures::Meas::thread(Meas *meas){
-  float temperature, pressure, humidity, gas_resistance, iaq;
+  float temperature, pressure, humidity, gas_resistance;
+  uint32_t duration_us;
+  struct timespec next_start, deadline;
   IAQTracker tracker;
 
   openlog("Weather app", 0, LOG_LOCAL1);
 
+  int timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC);
+  if(timer_fd == -1)
+    fprintf(stderr,"ERROR: Couldn't create the measures timer. Error description: %s\n", strerror(errno));
+
+  clock_gettime(CLOCK_MONOTONIC, &next_start);
+
   while(meas->run){
-    meas->sensor.get_data_one_measure(&temperature, &pressure, &humidity, &gas_resistance);
-    bme_data.temperature = temperature;
-    bme_data.pressure = pressure;
-    bme_data.humidity = humidity;
-    bme_data.altitude = obtain_sea_level_altitude(pressure);
-
-    if(tracker.get_IAQ(&iaq, temperature, humidity, gas_resistance) != -1)
-      bme_data.iaq = iaq;
-
-    syslog(LOG_INFO, "Temp: %.2f ºC,  Hum: %.2f %%,  Press: %.2f Pa,  Alt: %.2f m,  IAQ: %.2f\n",
-        (float)bme_data.temperature,
-        (float)bme_data.pressure,
-        (float)bme_data.humidity,
-        (float)bme_data.altitude,
-        (float)bme_data.iaq);
-
-    usleep(meas->measure_rate_us);
+    if(meas->sensor.start_measure(&duration_us) != -1){
+      clock_gettime(CLOCK_MONOTONIC, &deadline);
+      add_time_us(&deadline, duration_us);
+      wait_until(timer_fd, &deadline);
+
+      if(meas->sensor.read_measure(&temperature, &pressure, &humidity, &gas_resistance) != -1)
+        publish_measure(&tracker, temperature, pressure, humidity, gas_resistance);
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+    do{
+      add_time_us(&next_start, meas->measure_period_us);
+    }while(is_before(&next_start, &deadline));
+    wait_until(timer_fd, &next_start);
   }
 
+  if(timer_fd != -1)
+    close(timer_fd);
 }
 
 
@@ -191,6 +223,44 @@ Measures::Meas::~Meas(){
 
 /* Private functions ---------------------------------------------------------*/
 
+/**
+  * @brief     Stores a new measure in the shared data and the histories and logs it.
+  * @param[in] tracker The IAQ tracker that obtains the IAQ from the measures.
+  * @param[in] temperature The temperature obtained from the sensor.
+  * @param[in] pressure The pressure obtained from the sensor.
+  * @param[in] humidity The humidity obtained from the sensor.
+  * @param[in] gas_resistance The gas resistance of the hot plate obtained from the sensor.
+  */
+static void publish_measure(IAQTracker *tracker, float temperature, float pressure, float humidity,
+    float gas_resistance){
+  Measures::BME_DATA &data = Measures::bme_data;
+  Measures::BME_HISTORY &history = Measures::bme_history;
+  float iaq;
+
+  data.temperature = temperature;
+  data.pressure = pressure;
+  data.humidity = humidity;
+  data.altitude = obtain_sea_level_altitude(pressure);
+
+  if(tracker->get_IAQ(&iaq, temperature, humidity, gas_resistance) != -1){
+    data.iaq = iaq;
+    history.iaq.add(iaq);
+  }
+
+  history.temperature.add(temperature);
+  history.pressure.add(pressure);
+  history.humidity.add(humidity);
+  history.altitude.add(data.altitude);
+
+  syslog(LOG_INFO, "Temp: %.2f ºC,  Hum: %.2f %%,  Press: %.2f Pa,  Alt: %.2f m,  IAQ: %.2f\n",
+      (float)data.temperature,
+      (float)data.pressure,
+      (float)data.humidity,
+      (float)data.altitude,
+      (float)data.iaq);
+}
+
+
 /**
   * @brief     Converts a pressure measurement into a height in meters.
   * @param[in] pressure The pressure in Pascals.
@@ -199,3 +269,49 @@ Measures::Meas::~Meas(){
 static float obtain_sea_level_altitude(float pressure){
   return 44330.76923 * (1 - std::pow((float)(pressure / 101325.00), 0.190266));
 }
+
+
+/**
+  * @brief     Adds a number of microseconds to a time.
+  * @param[in,out] time The time to be increased.
+  * @param[in] us The microseconds to be added.
+  */
+static void add_time_us(struct timespec *time, uint32_t us){
+  time->tv_sec += us / 1000000;
+  time->tv_nsec += (long)(us % 1000000) * 1000;
+  if(time->tv_nsec >= 1000000000){
+    time->tv_sec++;
+    time->tv_nsec -= 1000000000;
+  }
+}
+
+
+/**
+  * @brief     Compares two times.
+  * @param[in] a The first time.
+  * @param[in] b The second time.
+  * @return    true if "a" is earlier than "b".
+  */
+static bool is_before(const struct timespec *a, const struct timespec *b){
+  return a->tv_sec < b->tv_sec || (a->tv_sec == b->tv_sec && a->tv_nsec < b->tv_nsec);
+}
+
+
+/**
+  * @brief     Sleeps until a time of the monotonic clock. It returns instantly if the time has already passed.
+  * @param[in] timer_fd The timer used to wait, or -1 to wait with clock_nanosleep.
+  * @param[in] deadline The time of the monotonic clock to wake up.
+  */
+static void wait_until(int timer_fd, const struct timespec *deadline){
+  struct itimerspec timer = {};
+  uint64_t expirations;
+
+  if(timer_fd != -1){
+    timer.it_value = *deadline;
+    if(timerfd_settime(timer_fd, TFD_TIMER_ABSTIME, &timer, NULL) != -1 &&
+        read(timer_fd, &expirations, sizeof(expirations)) == sizeof(expirations))
+      return;
+  }
+
+  while(clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, deadline, NULL) == EINTR);
+}
@@ -17,6 +17,7 @@
 #include <atomic>
 #include <thread>
 #include "BME688/BME688.h"
+#include "MeasureHistory/MeasureHistory.h"
 
 namespace Measures{
 
@@ -30,9 +31,20 @@ typedef struct {
     std::atomic<float> altitude;
 }BME_DATA;
 
+typedef struct {
+    MeasureHistory temperature;
+    MeasureHistory pressure;
+    MeasureHistory humidity;
+    MeasureHistory iaq;
+    MeasureHistory altitude;
+}BME_HISTORY;
+
 /* Exported variables --------------------------------------------------------*/
 extern BME_DATA bme_data;
+extern BME_HISTORY bme_history;
 /* Exported constants --------------------------------------------------------*/
+const int history_samples = 200;          //Samples kept of each measure
+const uint32_t history_period_s = 18;     //Seconds averaged in each sample, so the history covers the last hour
 /* Exported macro ------------------------------------------------------------*/
 /* Exported Functions --------------------------------------------------------*/
 
@@ -49,9 +61,9 @@ class Meas{
   float target_gas_temp;
   uint16_t gas_ms;
   std::thread *measures_thread;
-  uint32_t measure_rate_us;
+  uint32_t measure_period_us;
 
-  void init(uint8_t ovsp_temp, uint8_t ovsp_press, uint8_t ovsp_hum, float target_gas_temp, uint16_t gas_ms, uint32_t measure_rate_us);
+  void init(uint8_t ovsp_temp, uint8_t ovsp_press, uint8_t ovsp_hum, float target_gas_temp, uint16_t gas_ms, uint32_t measure_period_us);
   void change_oversamplings();
   static void thread(Meas *meas);
 public:
@@ -59,29 +71,29 @@ public:
   /**
    * @brief Class constructor with all the parameters as default.
    */
-  Meas (): Meas (OVSP_16_X, OVSP_16_X, OVSP_16_X, 300, 100, 25, 0, 100000) {};
+  Meas (): Meas (OVSP_16_X, OVSP_16_X, OVSP_16_X, 300, 100, 25, 0, 300000) {};
 
   /**
    * @brief Class constructor with parameters related with BME configurations as default.
    *
    * @param[in] temp_offset The temperature offset to be subtracted to the compensated temperature given by the BME sensor.
-   * @param[in] measure_rate_us The time in microseconds between the end of one measure and the start of the next.
+   * @param[in] measure_period_us The time in microseconds between the starts of two consecutive measures.
    *
    */
-  Meas (float temp_offset, uint32_t measure_rate_us): Meas (OVSP_16_X, OVSP_16_X, OVSP_16_X, 300, 100, 25, temp_offset, measure_rate_us) {};
+  Meas (float temp_offset, uint32_t measure_period_us): Meas (OVSP_16_X, OVSP_16_X, OVSP_16_X, 300, 100, 25, temp_offset, measure_period_us) {};
 
   /**
    * @brief Class constructor with parameters related with BME oversamplings as default.
    *
    * @param[in] target_gas_temp  The temperature that the hot plate of the gas sensor will reach to get the measure.
-   * @param[in] measure_rate_us  The time to obtain the desired temperature in the hot plate of the gas sensor. Should be greater than 30ms.
+   * @param[in] gas_ms           The time to obtain the desired temperature in the hot plate of the gas sensor. Should be greater than 30ms.
    * @param[in] amb_temp         An estimated ambient temperature for the gas sensor. The value doesn't have to be very accurate and a value
    *                             near 25ºC can be correct.
    * @param[in] temp_offset The temperature offset to be subtracted to the compensated temperature given by the BME sensor.
-   * @param[in] measure_rate_us The time in microseconds between the end of one measure and the start of the next.
+   * @param[in] measure_period_us The time in microseconds between the starts of two consecutive measures.
    *
    */
-  Meas (float target_gas_temp, uint16_t gas_ms, float amb_temp, float temp_offset, uint32_t measure_rate_us): Meas (OVSP_16_X, OVSP_16_X, OVSP_16_X, target_gas_temp, gas_ms, amb_temp, temp_offset, measure_rate_us) {};
+  Meas (float target_gas_temp, uint16_t gas_ms, float amb_temp, float temp_offset, uint32_t measure_period_us): Meas (OVSP_16_X, OVSP_16_X, OVSP_16_X, target_gas_temp, gas_ms, amb_temp, temp_offset, measure_period_us) {};
 
   /**
    * @brief Class constructor without parameters as default.
@@ -94,12 +106,12 @@ public:
    * @param[in] amb_temp         An estimated ambient temperature for the gas sensor. The value doesn't have to be very accurate and a value
    *                             near 25ºC can be correct.
    * @param[in] temp_offset The temperature offset to be subtracted to the compensated temperature given by the BME sensor.
-   * @param[in] measure_rate_us The time in microseconds between the end of one measure and the start of the next.
+   * @param[in] measure_period_us The time in microseconds between the starts of two consecutive measures.
    *
    */
   Meas (uint8_t ovsp_temp, uint8_t ovsp_press, uint8_t ovsp_hum, float target_gas_temp, uint16_t gas_ms, float amb_temp,
-      float temp_offset, uint32_t measure_rate_us):sensor(amb_temp, temp_offset){
-    this->init(ovsp_temp, ovsp_press, ovsp_hum, target_gas_temp, gas_ms, measure_rate_us);};
+      float temp_offset, uint32_t measure_period_us):sensor(amb_temp, temp_offset){
+    this->init(ovsp_temp, ovsp_press, ovsp_hum, target_gas_temp, gas_ms, measure_period_us);};
 
 
   /**
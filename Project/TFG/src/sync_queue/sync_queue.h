@@ -15,6 +15,7 @@
 /* Includes ------------------------------------------------------------------*/
 #include <queue>
 #include <mutex>
+#include <chrono>
 #include <condition_variable>
 
 
@@ -58,6 +59,25 @@ public:
     return item;
   }
 
+  /**
+   * @brief Obtain the oldest item of type `T` from the queue. If the queue is empty, the thread waits
+   *        until another thread push an item to the queue or "timeout_ms" milliseconds have passed.
+   *
+   * @param[out] item The oldest item of the queue.
+   * @param[in] timeout_ms The maximum time to wait in milliseconds.
+   *
+   * @return True if an item has been obtained, false if the time has passed.
+   *
+   */
+  bool pop(T *item, int timeout_ms){
+    std::unique_lock<std::mutex> lock(mutex);
+    if(!cond.wait_for(lock, std::chrono::milliseconds(timeout_ms), [this](){ return !queue.empty(); }))
+      return false;
+    *item = queue.front();
+    queue.pop();
+    return true;
+  }
+
 
   /**
    * @brief Return the number of elements in the queue.
@@ -0,0 +1,158 @@
+#!/usr/bin/env python3
+"""
+@file   font_compiler.py
+@author Pablo San Millán Fierro (pablo.sanmillanf@alumnos.upm.es)
+@brief  Converts the Adafruit GFX font sources into byte-aligned constexpr fonts.
+
+@note   End-of-degree work.
+        Every "<name>.h" file (the output of Adafruit's fontconvert) produces
+        a Font called "<name>". Glyph rows are padded to a whole byte, like the
+        icons, so every row starts at a byte boundary. If a "<name>.chars" file
+        exists next to the source, only the characters it contains are kept
+        and the rest get an empty glyph. The metrics that don't depend on the
+        string (ascent, descent and whether a glyph stays inside its advance
+        cell) are computed here instead of while drawing.
+
+        Usage: font_compiler.py -o font_bitmaps.h font1.h font2.h ...
+"""
+
+import argparse
+import os
+import re
+import sys
+
+
+def parse_gfx_font(path):
+    """Returns (bitmap, glyphs, first, last, y_advance). glyphs are (offset, w, h, x_adv, x_off, y_off) tuples."""
+    with open(path) as f:
+        text = re.sub(r'//[^\n]*', '', f.read())
+
+    bitmap_match = re.search(r'Bitmaps\[\]\s*(?:PROGMEM\s*)?=\s*\{([^}]*)\}', text)
+    glyphs_match = re.search(r'Glyphs\[\]\s*(?:PROGMEM\s*)?=\s*\{(.*?)\}\s*;', text, re.S)
+    font_match = re.search(r'GFXfont\s+\w+\s*(?:PROGMEM\s*)?=\s*\{[^,]*,[^,]*,\s*([^,]+),\s*([^,]+),\s*([^,}]+)\}', text)
+    if not bitmap_match or not glyphs_match or not font_match:
+        sys.exit('%s: not an Adafruit GFX font' % path)
+
+    bitmap = [int(v, 0) for v in bitmap_match.group(1).replace(',', ' ').split()]
+    glyphs = [tuple(int(v, 0) for v in g.split(','))
+              for g in re.findall(r'\{([^{}]*)\}', glyphs_match.group(1))]
+    first, last, y_advance = (int(v, 0) for v in font_match.groups())
+
+    if len(glyphs) != last - first + 1:
+        sys.exit('%s: %d glyphs for the range 0x%02X-0x%02X' % (path, len(glyphs), first, last))
+    return bitmap, glyphs, first, last, y_advance
+
+
+def read_charset(path):
+    """Returns the characters of the ".chars" file of a font source, or None if there isn't one."""
+    charset_path = os.path.splitext(path)[0] + '.chars'
+    if not os.path.exists(charset_path):
+        return None
+    with open(charset_path) as f:
+        return set(f.read().replace('\n', ''))
+
+
+def glyph_rows(bitmap, offset, width, height):
+    """Repacks the bit-packed rows of a GFX glyph so every row starts at a byte boundary."""
+    stride = (width + 7) // 8
+    packed = []
+    for y in range(height):
+        row = [0] * stride
+        for x in range(width):
+            bit = offset * 8 + y * width + x
+            if bitmap[bit // 8] & (0x80 >> (bit % 8)):
+                row[x // 8] |= 0x80 >> (x % 8)
+        packed.extend(row)
+    return packed
+
+
+def compile_font(path):
+    """Returns (name, first, last, y_advance, ascent, descent, bitmap, glyphs) of the compact font."""
+    name = os.path.splitext(os.path.basename(path))[0]
+    gfx_bitmap, gfx_glyphs, first, last, y_advance = parse_gfx_font(path)
+    charset = read_charset(path)
+
+    kept = [chr(first + i) for i in range(len(gfx_glyphs)) if charset is None or chr(first + i) in charset]
+    if not kept:
+        sys.exit('%s: no glyph left in the font' % path)
+    new_first, new_last = ord(kept[0]), ord(kept[-1])
+
+    bitmap, glyphs = [], []
+    ascent = descent = 0
+    for code in range(new_first, new_last + 1):
+        if chr(code) not in kept:
+            glyphs.append((0, 0, 0, 0, 0, 0, 1))
+            continue
+        offset, width, height, x_advance, x_offset, y_offset = gfx_glyphs[code - first]
+        inside_cell = 1 if x_offset >= 0 and x_offset + width <= x_advance else 0
+        glyphs.append((len(bitmap), width, height, x_advance, x_offset, y_offset, inside_cell))
+        bitmap.extend(glyph_rows(gfx_bitmap, offset, width, height))
+        if height > 0:
+            ascent = max(ascent, -y_offset)
+            descent = max(descent, y_offset + height)
+
+    if len(bitmap) > 0xFFFF:
+        sys.exit('%s: the bitmap doesn\'t fit the 16 bit glyph offsets' % path)
+    return name, new_first, new_last, y_advance, ascent, descent, bitmap, glyphs
+
+
+def char_comment(code):
+    """Printable description of a character for the glyph table comments."""
+    return "0x%02X '%s'" % (code, chr(code)) if chr(code) != '\\' else "0x%02X '\\\\'" % code
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('-o', '--output', required=True, help='Generated header')
+    parser.add_argument('sources', nargs='+', help='Adafruit GFX font sources')
+    args = parser.parse_args()
+
+    guard = '__' + os.path.basename(args.output).upper().replace('.', '_') + '__'
+    out = []
+    out.append('/**')
+    out.append('  ******************************************************************************')
+    out.append('  * @file   %s' % os.path.basename(args.output))
+    out.append('  * @brief  Byte-aligned application fonts.')
+    out.append('  *')
+    out.append('  * @note   Automatically generated by tools/font_compiler.py. Do not edit!')
+    out.append('  *         Glyph rows are padded to a whole byte and MSB is the leftmost')
+    out.append('  *         pixel. Characters left out of a font have an empty glyph.')
+    out.append('  ******************************************************************************')
+    out.append('*/')
+    out.append('')
+    out.append('#ifndef %s' % guard)
+    out.append('#define %s' % guard)
+    out.append('')
+    out.append('#include <cstdint>')
+    out.append('#include "font.h"')
+
+    for source in sorted(args.sources, key=os.path.basename):
+        name, first, last, y_advance, ascent, descent, bitmap, glyphs = compile_font(source)
+        kept = sum(1 for g in glyphs if g[3] > 0 or g[1] > 0)
+
+        out.append('')
+        out.append('// %s: %d glyphs from 0x%02X to 0x%02X, %d bitmap bytes' %
+                   (os.path.basename(source), kept, first, last, len(bitmap)))
+        out.append('inline constexpr uint8_t %sBitmaps[] = {' % name)
+        for i in range(0, len(bitmap), 16):
+            out.append('    ' + ', '.join('0x%02x' % b for b in bitmap[i:i + 16]) + ',')
+        out.append('};')
+        out.append('')
+        out.append('inline constexpr FontGlyph %sGlyphs[] = {' % name)
+        for code, glyph in zip(range(first, last + 1), glyphs):
+            out.append('    {%d, %d, %d, %d, %d, %d, %d},   // %s' % (glyph + (char_comment(code),)))
+        out.append('};')
+        out.append('')
+        out.append('inline constexpr Font %s = {' % name)
+        out.append('    %sBitmaps, %sGlyphs, 0x%02X, 0x%02X, %d, %d, %d};' %
+                   (name, name, first, last, y_advance, ascent, descent))
+
+    out.append('')
+    out.append('#endif /* %s */' % guard)
+
+    with open(args.output, 'w') as f:
+        f.write('\n'.join(out) + '\n')
+
+
+if __name__ == '__main__':
+    main()
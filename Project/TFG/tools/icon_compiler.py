@@ -0,0 +1,127 @@
+#!/usr/bin/env python3
+"""
+@file   icon_compiler.py
+@author Pablo San Millán Fierro (pablo.sanmillanf@alumnos.upm.es)
+@brief  Converts the PBM icon sources into packed 1-bpp constexpr arrays.
+
+@note   End-of-degree work.
+        Every "<name>.pbm" file (P1 or P4) produces an array called "<name>"
+        inside the Icons namespace. Rows are padded to a whole byte and the
+        most significant bit is the leftmost pixel. White pixels are stored as
+        1 (drawn with the "color" of Display_driver::draw_icon_col) and black
+        pixels as 0 (drawn with its "background_color").
+
+        Usage: icon_compiler.py -o icon_bitmaps.h icon1.pbm icon2.pbm ...
+"""
+
+import argparse
+import os
+import sys
+
+
+def read_tokens(data, count, pos):
+    """Reads "count" whitespace separated header tokens skipping comments."""
+    tokens = []
+    while len(tokens) < count:
+        while data[pos:pos + 1].isspace():
+            pos += 1
+        if data[pos:pos + 1] == b'#':
+            while data[pos:pos + 1] not in (b'\n', b''):
+                pos += 1
+            continue
+        start = pos
+        while pos < len(data) and not data[pos:pos + 1].isspace():
+            pos += 1
+        tokens.append(data[start:pos])
+    return tokens, pos
+
+
+def read_pbm(path):
+    """Returns (width, height, rows) where rows is a list of lists of 0/1 values (1 = black)."""
+    with open(path, 'rb') as f:
+        data = f.read()
+
+    (magic, width, height), pos = read_tokens(data, 3, 0)
+    width, height = int(width), int(height)
+
+    if magic == b'P4':
+        pos += 1  # Single whitespace after the header
+        stride = (width + 7) // 8
+        raster = data[pos:pos + stride * height]
+        if len(raster) != stride * height:
+            sys.exit('%s: truncated raster' % path)
+        rows = [[(raster[y * stride + x // 8] >> (7 - x % 8)) & 1 for x in range(width)] for y in range(height)]
+    elif magic == b'P1':
+        bits = [int(c) for c in data[pos:].decode('ascii') if c in '01']
+        if len(bits) < width * height:
+            sys.exit('%s: truncated raster' % path)
+        rows = [bits[y * width:(y + 1) * width] for y in range(height)]
+    else:
+        sys.exit('%s: only P1 and P4 PBM files are supported' % path)
+
+    return width, height, rows
+
+
+def pack(width, rows):
+    """Packs the rows inverting the PBM convention, so white pixels are stored as 1."""
+    packed = []
+    for row in rows:
+        for x in range(0, width, 8):
+            byte = 0
+            for bit in range(8):
+                if x + bit < width and not row[x + bit]:
+                    byte |= 0x80 >> bit
+            packed.append(byte)
+    return packed
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('-o', '--output', required=True, help='Generated header')
+    parser.add_argument('sources', nargs='+', help='PBM icon sources')
+    args = parser.parse_args()
+
+    guard = '__' + os.path.basename(args.output).upper().replace('.', '_') + '__'
+    out = []
+    out.append('/**')
+    out.append('  ******************************************************************************')
+    out.append('  * @file   %s' % os.path.basename(args.output))
+    out.append('  * @brief  Packed 1-bpp application icons.')
+    out.append('  *')
+    out.append('  * @note   Automatically generated by tools/icon_compiler.py. Do not edit!')
+    out.append('  *         Rows are padded to a whole byte, MSB is the leftmost pixel and')
+    out.append('  *         set bits are the white pixels of the source image.')
+    out.append('  ******************************************************************************')
+    out.append('*/')
+    out.append('')
+    out.append('#ifndef %s' % guard)
+    out.append('#define %s' % guard)
+    out.append('')
+    out.append('#include <array>')
+    out.append('#include <cstdint>')
+    out.append('')
+    out.append('namespace Icons{')
+
+    for source in sorted(args.sources, key=os.path.basename):
+        name = os.path.splitext(os.path.basename(source))[0]
+        width, height, rows = read_pbm(source)
+        packed = pack(width, rows)
+
+        out.append('')
+        out.append('// %s: %d x %d pixels' % (os.path.basename(source), width, height))
+        out.append('inline constexpr std::array<uint8_t, %d> %s = {' % (len(packed), name))
+        for i in range(0, len(packed), 16):
+            out.append('    ' + ', '.join('0x%02x' % b for b in packed[i:i + 16]) + ',')
+        out.append('};')
+
+    out.append('')
+    out.append('}')
+    out.append('')
+    out.append('#endif /* %s */' % guard)
+
+    with open(args.output, 'w') as f:
+        f.write('\n'.join(out) + '\n')
+
+
+if __name__ == '__main__':
+    main()